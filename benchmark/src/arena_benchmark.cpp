@@ -0,0 +1,101 @@
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/json_io_handler.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+namespace
+{
+enum class Allocation
+{
+  HEAP,
+  POOL,
+  MONOTONIC
+};
+
+std::shared_ptr<std::pmr::memory_resource> createMemoryResource(Allocation allocation)
+{
+  switch (allocation)
+  {
+    case Allocation::POOL:
+      return std::make_shared<std::pmr::synchronized_pool_resource>();
+    case Allocation::MONOTONIC:
+      return std::make_shared<std::pmr::monotonic_buffer_resource>(1024 * 1024);
+    default:
+      return std::shared_ptr<std::pmr::memory_resource>(std::shared_ptr<void>(), std::pmr::new_delete_resource());
+  }
+}
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+const char* allocationName(Allocation allocation)
+{
+  switch (allocation)
+  {
+    case Allocation::POOL:
+      return "pool";
+    case Allocation::MONOTONIC:
+      return "monotonic";
+    default:
+      return "heap";
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+
+  std::string yaml_string;
+  std::string json_string;
+  {
+    ParameterInterface generated_parameters;
+    benchmark::generateConfiguration(parameter_count, generated_parameters);
+    YamlIOHandler::writeParametersToString(generated_parameters, yaml_string);
+    JsonIOHandler::writeParametersToString(generated_parameters, json_string);
+  }
+
+  std::cout << parameter_count << " parameters, best of " << repetitions << " runs" << std::endl;
+  std::cout << "format  conversion  allocation  load [ms]  teardown [ms]" << std::endl;
+  for (bool json : { false, true })
+  {
+    for (auto conversion : { ParameterIOBackend::Conversion::EAGER, ParameterIOBackend::Conversion::DEFERRED })
+    {
+      for (auto allocation : { Allocation::HEAP, Allocation::POOL, Allocation::MONOTONIC })
+      {
+        double load_time = std::numeric_limits<double>::max();
+        double teardown_time = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < repetitions; i++)
+        {
+          auto start = std::chrono::steady_clock::now();
+          // the string pool and the parameter map share the memory resource
+          auto memory_resource = createMemoryResource(allocation);
+          auto parameters = std::make_unique<ParameterInterface>(std::make_shared<StringPool>(memory_resource), memory_resource);
+          memory_resource.reset();
+          if (json)
+            JsonIOHandler::readAndAddParametersFromString(json_string, *parameters, conversion);
+          else
+            YamlIOHandler::readAndAddParametersFromString(yaml_string, *parameters, conversion);
+          load_time = std::min(load_time, elapsedMilliseconds(start));
+
+          start = std::chrono::steady_clock::now();
+          parameters.reset();
+          teardown_time = std::min(teardown_time, elapsedMilliseconds(start));
+        }
+        std::cout << (json ? "JSON" : "YAML") << "  " << (conversion == ParameterIOBackend::Conversion::EAGER ? "eager" : "deferred") << "  "
+                  << allocationName(allocation) << "  " << load_time << "  " << teardown_time << std::endl;
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+namespace benchmark
+{
+/**
+ * @brief Fills the interface with a synthetic configuration of the given number of parameters, which are distributed over three
+ * levels of namespaces and cover all supported types.
+ * @param parameter_count number of parameters
+ * @param parameter_interface the interface the parameters are added to
+ */
+inline void generateConfiguration(size_t parameter_count, ParameterInterface& parameter_interface)
+{
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  for (size_t i = 0; i < parameter_count; i++)
+  {
+    std::string name = "robot_" + std::to_string(i % 16) + "/component_" + std::to_string(i / 16 % 32) + "/module_" + std::to_string(i / 512) + "/parameter_" +
+                       std::to_string(i);
+    switch (i % 8)
+    {
+      case 0:
+        transaction.setParam(name, static_cast<int>(i));
+        break;
+      case 1:
+        transaction.setParam(name, i * 0.001 - 3.5);
+        break;
+      case 2:
+        transaction.setParam(name, i % 3 == 0);
+        break;
+      case 3:
+        transaction.setParam(name, "value_" + std::to_string(i));
+        break;
+      case 4:
+        transaction.setParam(name, std::vector<int>{ static_cast<int>(i), -1, 0, 42 });
+        break;
+      case 5:
+        transaction.setParam(name, std::vector<double>{ 0.5, i * 0.25, -1e-3 });
+        break;
+      case 6:
+        transaction.setParam(name, std::vector<bool>{ true, false, i % 2 == 0 });
+        break;
+      default:
+        transaction.setParam(name, std::vector<std::string>{ "joint_a", "joint_b", "joint_" + std::to_string(i) });
+        break;
+    }
+  }
+  transaction.commit();
+}
+
+/**
+ * @brief Returns the minimal duration of the repeated calls of the function in milliseconds.
+ * @param repetitions number of calls
+ * @param function the measured function
+ * @return the minimal duration in milliseconds
+ */
+template <typename Function>
+double measureMilliseconds(size_t repetitions, Function&& function)
+{
+  double best = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < repetitions; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    best = std::min(best, duration.count());
+  }
+  return best;
+}
+}  // namespace benchmark
+}  // namespace paraminf
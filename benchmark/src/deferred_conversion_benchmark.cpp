@@ -0,0 +1,130 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/json_io_handler.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+namespace
+{
+// every allocation is prefixed with its size to track the number of live heap bytes
+constexpr size_t header_size = alignof(std::max_align_t);
+std::atomic<size_t> live_bytes{ 0 };
+}  // namespace
+
+void* operator new(size_t size)
+{
+  void* memory = std::malloc(size + header_size);
+  if (!memory)
+    throw std::bad_alloc();
+  *static_cast<size_t*>(memory) = size;
+  live_bytes += size;
+  return static_cast<char*>(memory) + header_size;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  if (!pointer)
+    return;
+  void* memory = static_cast<char*>(pointer) - header_size;
+  live_bytes -= *static_cast<size_t*>(memory);
+  std::free(memory);
+}
+
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+
+namespace
+{
+// reads the parameter with the type it has been generated with, like a consumer knowing the type would
+void readParameter(const ParameterInterface& parameters, const std::string& parameter_name)
+{
+  size_t index = std::stoul(parameter_name.substr(parameter_name.rfind('_') + 1));
+  switch (index % 8)
+  {
+    case 0:
+      parameters.getParam<int>(parameter_name);
+      break;
+    case 1:
+      parameters.getParam<double>(parameter_name);
+      break;
+    case 2:
+      parameters.getParam<bool>(parameter_name);
+      break;
+    case 3:
+      parameters.getParam<std::string>(parameter_name);
+      break;
+    case 4:
+      parameters.getParam<std::vector<int>>(parameter_name);
+      break;
+    case 5:
+      parameters.getParam<std::vector<double>>(parameter_name);
+      break;
+    case 6:
+      parameters.getParam<std::vector<bool>>(parameter_name);
+      break;
+    default:
+      parameters.getParam<std::vector<std::string>>(parameter_name);
+      break;
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 200000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+  // every n-th parameter is read after loading
+  size_t read_stride = argc > 3 ? std::stoul(argv[3]) : 100;
+
+  std::string yaml_string;
+  std::string json_string;
+  std::vector<std::string> parameter_names;
+  {
+    ParameterInterface generated_parameters;
+    benchmark::generateConfiguration(parameter_count, generated_parameters);
+    YamlIOHandler::writeParametersToString(generated_parameters, yaml_string);
+    JsonIOHandler::writeParametersToString(generated_parameters, json_string);
+    parameter_names = generated_parameters.getAllParameterNames();
+  }
+
+  std::cout << parameter_count << " parameters, every " << read_stride << ". parameter read, best of " << repetitions << " runs" << std::endl;
+  std::cout << "format  conversion  load [ms]  load and read [ms]  loaded [MB]" << std::endl;
+  for (bool json : { false, true })
+  {
+    for (auto conversion : { ParameterIOBackend::Conversion::EAGER, ParameterIOBackend::Conversion::DEFERRED })
+    {
+      auto load = [&](ParameterInterface& parameters) {
+        if (json)
+          JsonIOHandler::readAndAddParametersFromString(json_string, parameters, conversion);
+        else
+          YamlIOHandler::readAndAddParametersFromString(yaml_string, parameters, conversion);
+      };
+      double load_time = benchmark::measureMilliseconds(repetitions, [&]() {
+        ParameterInterface parameters;
+        load(parameters);
+      });
+      double read_time = benchmark::measureMilliseconds(repetitions, [&]() {
+        ParameterInterface parameters;
+        load(parameters);
+        for (size_t i = 0; i < parameter_names.size(); i += read_stride)
+        {
+          readParameter(parameters, parameter_names[i]);
+        }
+      });
+
+      size_t initial_bytes = live_bytes;
+      ParameterInterface parameters;
+      load(parameters);
+      size_t loaded_bytes = live_bytes - initial_bytes;
+
+      std::cout << (json ? "JSON" : "YAML") << "  " << (conversion == ParameterIOBackend::Conversion::EAGER ? "eager" : "deferred") << "  " << load_time << "  "
+                << read_time << "  " << loaded_bytes / 1e6 << std::endl;
+    }
+  }
+  return 0;
+}
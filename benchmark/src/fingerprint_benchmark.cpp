@@ -0,0 +1,59 @@
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t update_count = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+  ParameterInterface parameters;
+  benchmark::generateConfiguration(parameter_count, parameters);
+  std::vector<std::string> names = parameters.getAllParameterNames();
+
+  double text_hash_time = benchmark::measureMilliseconds(3, [&]() {
+    std::string yaml_string;
+    YamlIOHandler::writeParametersToString(parameters, yaml_string);
+    volatile size_t hash = std::hash<std::string>()(yaml_string);
+    (void)hash;
+  });
+
+  double build_time = benchmark::measureMilliseconds(3, [&]() {
+    ParameterInterface copy(parameters);
+    copy.getFingerprint();
+  });
+  parameters.getFingerprint();
+
+  volatile uint64_t fingerprint = 0;
+  double query_time = benchmark::measureMilliseconds(3, [&]() {
+    for (size_t i = 0; i < update_count; i++)
+    {
+      fingerprint = parameters.getFingerprint("robot_" + std::to_string(i % 16));
+    }
+  });
+
+  auto update = [&](ParameterInterface& parameter_interface) {
+    for (size_t i = 0; i < update_count; i++)
+    {
+      parameter_interface.setParam(names[i % names.size()], static_cast<int>(i));
+    }
+  };
+  ParameterInterface untracked(parameters);
+  ParameterInterface untracked_copy;
+  untracked_copy.mergeParameters(untracked);
+  double untracked_update_time = benchmark::measureMilliseconds(3, [&]() { update(untracked_copy); });
+  double tracked_update_time = benchmark::measureMilliseconds(3, [&]() { update(parameters); });
+
+  std::cout << parameter_count << " parameters" << std::endl;
+  std::cout << "YAML dump and text hash [ms]: " << text_hash_time << std::endl;
+  std::cout << "initial fingerprint build [ms]: " << build_time << std::endl;
+  std::cout << "fingerprint query [ns]: " << query_time / update_count * 1e6 << std::endl;
+  std::cout << "setParam without / with fingerprints [ns]: " << untracked_update_time / update_count * 1e6 << " / " << tracked_update_time / update_count * 1e6
+            << std::endl;
+  return 0;
+}
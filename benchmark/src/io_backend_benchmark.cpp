@@ -0,0 +1,37 @@
+#include <iostream>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/json_io_handler.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 5;
+
+  ParameterInterface parameters;
+  benchmark::generateConfiguration(parameter_count, parameters);
+
+  std::vector<std::pair<std::string, ParameterIOBackend::Ptr>> backends = { { "yaml", std::make_shared<YamlIOBackend>() },
+                                                                              { "json", std::make_shared<JsonIOBackend>() } };
+
+  std::cout << parameter_count << " parameters, best of " << repetitions << " runs" << std::endl;
+  std::cout << "backend  size [MB]  write [ms]  read [ms]  read [MB/s]" << std::endl;
+  for (const auto& backend : backends)
+  {
+    std::string output;
+    double write_time = benchmark::measureMilliseconds(repetitions, [&]() { backend.second->writeParametersToString(parameters, output); });
+    double read_time = benchmark::measureMilliseconds(repetitions, [&]() {
+      ParameterInterface read_parameters;
+      if (!backend.second->readAndAddParametersFromString(output, read_parameters) || read_parameters.getAllParameterNames().size() != parameter_count)
+        std::cerr << "Reading " << backend.first << " failed" << std::endl;
+    });
+
+    double size = output.size() / 1e6;
+    std::cout << backend.first << "  " << size << "  " << write_time << "  " << read_time << "  " << size / read_time * 1e3 << std::endl;
+  }
+  return 0;
+}
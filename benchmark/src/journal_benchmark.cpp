@@ -0,0 +1,66 @@
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/parameter_journal.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t update_count = argc > 2 ? std::stoul(argv[2]) : 10000;
+
+  const std::string base_file_path = "journal_benchmark_base.yaml";
+  const std::string journal_file_path = "journal_benchmark.journal";
+  std::remove(journal_file_path.c_str());
+  {
+    ParameterInterface parameters;
+    benchmark::generateConfiguration(parameter_count, parameters);
+    YamlIOHandler::writeParametersToFile(base_file_path, parameters);
+  }
+
+  ParameterInterface::Ptr parameters = std::make_shared<ParameterInterface>();
+  double load_time = benchmark::measureMilliseconds(1, [&]() { ParameterJournal journal(parameters, base_file_path, journal_file_path); });
+  ParameterJournal journal(parameters, base_file_path, journal_file_path, std::chrono::milliseconds(10), 0);
+
+  // one update persisted by rewriting the whole file compared to one update persisted by the journal
+  double dump_time = benchmark::measureMilliseconds(3, [&]() { YamlIOHandler::writeParametersToFile(base_file_path + ".dump", *parameters); });
+  double synced_update_time = benchmark::measureMilliseconds(100, [&]() {
+    journal.setParam("robot_0/component_0/module_0/parameter_1", 0.5);
+    journal.sync().get();
+  });
+
+  // many updates share the syncs of a batch
+  double batched_time = benchmark::measureMilliseconds(1, [&]() {
+    for (size_t i = 0; i < update_count; i++)
+    {
+      journal.setParam("robot_0/component_0/module_0/parameter_1", i * 0.5);
+    }
+    journal.sync().get();
+  });
+
+  size_t journal_size = journal.getJournalSize();
+  double replay_time = benchmark::measureMilliseconds(3, [&]() {
+    ParameterInterface replayed;
+    size_t record_count;
+    ParameterJournal::replay(journal_file_path, replayed, record_count);
+  });
+
+  double compaction_time = benchmark::measureMilliseconds(1, [&]() { journal.requestCompaction().get(); });
+
+  std::cout << parameter_count << " parameters, " << update_count << " batched updates" << std::endl;
+  std::cout << "load base [ms]: " << load_time << std::endl;
+  std::cout << "full dump [ms]: " << dump_time << std::endl;
+  std::cout << "synced journal update [ms]: " << synced_update_time << std::endl;
+  std::cout << "batched journal updates [updates/s]: " << update_count / batched_time * 1e3 << std::endl;
+  std::cout << "replay of " << journal_size << " bytes [ms]: " << replay_time << std::endl;
+  std::cout << "compaction [ms]: " << compaction_time << std::endl;
+
+  std::remove(base_file_path.c_str());
+  std::remove((base_file_path + ".dump").c_str());
+  std::remove(journal_file_path.c_str());
+  return 0;
+}
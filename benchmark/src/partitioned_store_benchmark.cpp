@@ -0,0 +1,64 @@
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+#include "benchmark_config.h"
+#include "paraminf/partitioned_parameter_store.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+  size_t partition_depth = argc > 3 ? std::stoul(argv[3]) : 2;
+
+  const std::string single_file_path = "partitioned_store_benchmark.yaml";
+  const std::string directory_path = "partitioned_store_benchmark";
+
+  ParameterInterface::Ptr parameters = std::make_shared<ParameterInterface>();
+  benchmark::generateConfiguration(parameter_count, *parameters);
+
+  double single_write_time = benchmark::measureMilliseconds(repetitions, [&]() { YamlIOHandler::writeParametersToFile(single_file_path, *parameters); });
+  double single_read_time = benchmark::measureMilliseconds(repetitions, [&]() {
+    ParameterInterface loaded;
+    YamlIOHandler::readAndAddParametersFromFile(single_file_path, loaded);
+  });
+
+  double initial_save_time;
+  double update_save_time;
+  size_t partition_count;
+  {
+    PartitionedParameterStore store(parameters, directory_path, partition_depth);
+    initial_save_time = benchmark::measureMilliseconds(1, [&]() { store.save(); });
+    partition_count = store.getWriteCount();
+
+    // a single changed parameter only rewrites its partition
+    size_t update = 0;
+    update_save_time = benchmark::measureMilliseconds(repetitions, [&]() {
+      parameters->setParam("robot_0/component_0/module_0/parameter_1", ++update * 0.5);
+      store.save();
+    });
+  }
+
+  double partitioned_load_time = benchmark::measureMilliseconds(repetitions, [&]() {
+    ParameterInterface::Ptr loaded = std::make_shared<ParameterInterface>();
+    PartitionedParameterStore store(loaded, directory_path, partition_depth);
+    store.load();
+  });
+
+  std::cout << parameter_count << " parameters in " << partition_count << " partitions of depth " << partition_depth << ", best of " << repetitions << " runs"
+            << std::endl;
+  std::cout << "single file write [ms]: " << single_write_time << std::endl;
+  std::cout << "single file read [ms]: " << single_read_time << std::endl;
+  std::cout << "initial partitioned save [ms]: " << initial_save_time << std::endl;
+  std::cout << "save after single update [ms]: " << update_save_time << std::endl;
+  std::cout << "partitioned load [ms]: " << partitioned_load_time << std::endl;
+
+  std::remove(single_file_path.c_str());
+  std::system(("rm -r " + directory_path).c_str());
+  return 0;
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "paraminf/parameter_client.h"
+#include "paraminf/parameter_server.h"
+
+using namespace paraminf;
+
+namespace
+{
+constexpr size_t PARAMETER_COUNT = 10000;
+constexpr size_t BATCH_SIZE = 32;
+constexpr size_t PIPELINE_DEPTH = 16;
+constexpr size_t BATCHES_PER_CLIENT = 20000;
+
+double percentile(std::vector<double>& values, double fraction)
+{
+  size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::vector<size_t> client_counts = { 1, 2, 4, 8, 16 };
+  if (argc > 1)
+    client_counts = { static_cast<size_t>(std::stoul(argv[1])) };
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  std::vector<std::string> parameter_names;
+  for (size_t i = 0; i < PARAMETER_COUNT; i++)
+  {
+    parameter_names.push_back("group_" + std::to_string(i % 100) + "/parameter_" + std::to_string(i));
+    parameter_interface->setParam(parameter_names.back(), static_cast<double>(i));
+  }
+
+  std::string socket_path = "/tmp/paraminf_benchmark_" + std::to_string(getpid()) + ".sock";
+  ParameterServer server(socket_path, parameter_interface);
+
+  std::cout << "clients  batches/s  parameters/s  p50 [us]  p99 [us]" << std::endl;
+  for (size_t client_count : client_counts)
+  {
+    std::vector<std::vector<double>> latencies(client_count);
+    std::vector<std::thread> clients;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t c = 0; c < client_count; c++)
+    {
+      clients.emplace_back([&, c]() {
+        ParameterClient client(socket_path);
+        std::vector<std::string> batch(BATCH_SIZE);
+        std::vector<std::pair<uint32_t, std::chrono::steady_clock::time_point>> pending;
+        latencies[c].reserve(BATCHES_PER_CLIENT);
+        size_t sent = 0;
+        while (latencies[c].size() < BATCHES_PER_CLIENT)
+        {
+          // keep the pipeline filled before waiting for the oldest response
+          while (pending.size() < PIPELINE_DEPTH && sent < BATCHES_PER_CLIENT)
+          {
+            for (size_t i = 0; i < BATCH_SIZE; i++)
+            {
+              batch[i] = parameter_names[(sent * BATCH_SIZE + i + c * 7919) % PARAMETER_COUNT];
+            }
+            pending.emplace_back(client.sendGetRequest(batch), std::chrono::steady_clock::now());
+            sent++;
+          }
+
+          ParameterInterface result;
+          client.receiveResponse(pending.front().first, &result);
+          std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - pending.front().second;
+          latencies[c].push_back(latency.count());
+          pending.erase(pending.begin());
+        }
+      });
+    }
+    for (auto& client : clients)
+    {
+      client.join();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    std::vector<double> all_latencies;
+    for (const auto& client_latencies : latencies)
+    {
+      all_latencies.insert(all_latencies.end(), client_latencies.begin(), client_latencies.end());
+    }
+    double batches_per_second = all_latencies.size() / duration.count();
+    std::cout << client_count << "  " << static_cast<size_t>(batches_per_second) << "  " << static_cast<size_t>(batches_per_second * BATCH_SIZE) << "  "
+              << percentile(all_latencies, 0.5) << "  " << percentile(all_latencies, 0.99) << std::endl;
+  }
+  return 0;
+}
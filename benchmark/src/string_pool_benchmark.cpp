@@ -0,0 +1,70 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "benchmark_config.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+namespace
+{
+// every allocation is prefixed with its size to track the number of live heap bytes
+constexpr size_t header_size = alignof(std::max_align_t);
+std::atomic<size_t> live_bytes{ 0 };
+}  // namespace
+
+void* operator new(size_t size)
+{
+  void* memory = std::malloc(size + header_size);
+  if (!memory)
+    throw std::bad_alloc();
+  *static_cast<size_t*>(memory) = size;
+  live_bytes += size;
+  return static_cast<char*>(memory) + header_size;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  if (!pointer)
+    return;
+  void* memory = static_cast<char*>(pointer) - header_size;
+  live_bytes -= *static_cast<size_t*>(memory);
+  std::free(memory);
+}
+
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t copy_count = argc > 2 ? std::stoul(argv[2]) : 4;
+
+  std::string yaml_string;
+  {
+    ParameterInterface generated_parameters;
+    benchmark::generateConfiguration(parameter_count, generated_parameters);
+    YamlIOHandler::writeParametersToString(generated_parameters, yaml_string);
+  }
+
+  size_t initial_bytes = live_bytes;
+  ParameterInterface parameters;
+  if (!YamlIOHandler::readAndAddParametersFromString(yaml_string, parameters))
+  {
+    std::cerr << "Reading the configuration failed" << std::endl;
+    return 1;
+  }
+  size_t loaded_bytes = live_bytes - initial_bytes;
+
+  // copies of the interface, e.g. handed to several components
+  std::vector<ParameterInterface> copies(copy_count, parameters);
+  size_t copied_bytes = live_bytes - initial_bytes - loaded_bytes;
+
+  std::cout << parameter_count << " parameters, " << copy_count << " copies" << std::endl;
+  std::cout << "loaded [MB]  per parameter [B]  per copy [MB]" << std::endl;
+  std::cout << loaded_bytes / 1e6 << "  " << static_cast<double>(loaded_bytes) / parameter_count << "  " << (copy_count ? copied_bytes / 1e6 / copy_count : 0.0)
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include <iostream>
+#include <string>
+
+#include "benchmark_config.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t update_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+  size_t max_subscription_count = argc > 3 ? std::stoul(argv[3]) : 100000;
+
+  std::cout << update_count << " updates of a parameter matched by 2 subscriptions, best of " << repetitions << " runs" << std::endl;
+  std::cout << "subscriptions  per update [ns]" << std::endl;
+  for (size_t subscription_count = 0; subscription_count <= max_subscription_count; subscription_count = subscription_count == 0 ? 10 : subscription_count * 10)
+  {
+    ParameterInterface parameters;
+    size_t notification_count = 0;
+    // all but two of the subscriptions are registered on namespaces that do not contain the updated parameter
+    for (size_t i = 0; i + 2 < subscription_count; i++)
+    {
+      parameters.subscribe("robot_" + std::to_string(i) + "/component", [](const std::vector<std::string>&) {});
+    }
+    if (subscription_count >= 2)
+    {
+      parameters.subscribe("robot", [&](const std::vector<std::string>& names) { notification_count += names.size(); });
+      parameters.subscribe("robot/component/gain", [&](const std::vector<std::string>& names) { notification_count += names.size(); });
+    }
+
+    double time = benchmark::measureMilliseconds(repetitions, [&]() {
+      for (size_t i = 0; i < update_count; i++)
+      {
+        parameters.setParam("robot/component/gain", static_cast<int>(i));
+      }
+    });
+    std::cout << subscription_count << "  " << time * 1e6 / update_count << std::endl;
+  }
+  return 0;
+}
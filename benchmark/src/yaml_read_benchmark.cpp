@@ -0,0 +1,42 @@
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "benchmark_config.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+  size_t max_thread_count = argc > 3 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+  std::string input;
+  uint64_t expected_fingerprint;
+  {
+    ParameterInterface parameters;
+    benchmark::generateConfiguration(parameter_count, parameters);
+    YamlIOHandler::writeParametersToString(parameters, input, 1);
+    expected_fingerprint = parameters.getFingerprint();
+  }
+
+  std::cout << parameter_count << " parameters, " << input.size() / 1e6 << " MB, " << std::thread::hardware_concurrency() << " hardware threads, best of "
+            << repetitions << " runs" << std::endl;
+  std::cout << "threads  read [ms]  speedup  identical" << std::endl;
+  double sequential_time = 0.0;
+  for (size_t thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+  {
+    bool identical = true;
+    double time = benchmark::measureMilliseconds(repetitions, [&]() {
+      ParameterInterface parameters;
+      YamlIOHandler::readAndAddParametersFromString(input, parameters, thread_count);
+      identical &= parameters.getFingerprint() == expected_fingerprint;
+    });
+    if (thread_count == 1)
+      sequential_time = time;
+    std::cout << thread_count << "  " << time << "  " << sequential_time / time << "  " << (identical ? "yes" : "no") << std::endl;
+  }
+  return 0;
+}
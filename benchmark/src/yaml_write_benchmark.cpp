@@ -0,0 +1,35 @@
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "benchmark_config.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+  size_t max_thread_count = argc > 3 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+  ParameterInterface parameters;
+  benchmark::generateConfiguration(parameter_count, parameters);
+
+  std::string sequential_output;
+  YamlIOHandler::writeParametersToString(parameters, sequential_output, 1);
+
+  std::cout << parameter_count << " parameters, " << sequential_output.size() / 1e6 << " MB, " << std::thread::hardware_concurrency()
+            << " hardware threads, best of " << repetitions << " runs" << std::endl;
+  std::cout << "threads  write [ms]  speedup  identical" << std::endl;
+  double sequential_time = 0.0;
+  for (size_t thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+  {
+    std::string output;
+    double time = benchmark::measureMilliseconds(repetitions, [&]() { YamlIOHandler::writeParametersToString(parameters, output, thread_count); });
+    if (thread_count == 1)
+      sequential_time = time;
+    std::cout << thread_count << "  " << time << "  " << sequential_time / time << "  " << (output == sequential_output ? "yes" : "no") << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "paraminf/parameter_interface.h"
+#include "paraminf/parameter_io_backend.h"
+
+namespace paraminf
+{
+/**
+ * @brief The JsonIOHandler class can be used to read parameters from and write parameters to JSON files.
+ * @details Objects are mapped to namespaces like maps in YAML files. Scalars and arrays are converted with the same rules as by
+ * the YamlIOHandler, see ParameterIOBackend, i.e. loading a JSON file results in the same parameters as loading it as YAML.
+ * The parser works directly on the input string and only allocates memory for the parameters themselves. Non-finite doubles
+ * are written as the strings ".inf", "-.inf" and ".nan", which are converted back to doubles when reading.
+ */
+class JsonIOHandler
+{
+public:
+  /**
+   * @brief Reads the parameters from a JSON file and adds them to the specified interface.
+   * @details The parameters are only added if the whole file is valid.
+   * @param json_file_path path to the JSON file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromFile(const std::string& json_file_path, ParameterInterface& parameter_interface);
+
+  /**
+   * @brief Reads the parameters from a JSON string and adds them to the specified interface.
+   * @details The parameters are only added if the whole string is valid.
+   * @param json_input_string input JSON string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromString(std::string_view json_input_string, ParameterInterface& parameter_interface);
+
+  /**
+   * @brief Reads the parameters from a JSON file with the given conversion and adds them to the specified interface.
+   * @details With deferred conversion the decoded texts of all scalars and arrays are copied into blocks shared by the
+   * RawParameterValue of each parameter and are converted on access. The parameters are only added if the whole file is valid.
+   * @param json_file_path path to the JSON file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param conversion conversion of the values
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromFile(const std::string& json_file_path, ParameterInterface& parameter_interface, ParameterIOBackend::Conversion conversion);
+
+  /**
+   * @brief Reads the parameters from a JSON string with the given conversion and adds them to the specified interface.
+   * @details See readAndAddParametersFromFile() with conversion for details.
+   * @param json_input_string input JSON string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param conversion conversion of the values
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromString(std::string_view json_input_string, ParameterInterface& parameter_interface,
+                                             ParameterIOBackend::Conversion conversion);
+
+  /**
+   * @brief Writes the parameters of the given parameter interface to a JSON file.
+   * @param json_file_path path of the file where the parameters should be written
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @return true if wirting has been succesful
+   */
+  static bool writeParametersToFile(const std::string& json_file_path, const ParameterInterface& parameter_interface);
+
+  /**
+   * @brief Writes the parameters of the given parameter interface to a JSON string.
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @param json_output_string the string the JSON output is written to
+   * @return true if wirting has been succesful
+   */
+  static bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& json_output_string);
+
+private:
+  class Parser;
+  class WriterVisitor;
+};
+
+/**
+ * @brief The JsonIOBackend class provides the JsonIOHandler as ParameterIOBackend.
+ */
+class JsonIOBackend : public ParameterIOBackend
+{
+public:
+  /**
+   * @brief Creates the backend.
+   * @param conversion conversion of the values read by the backend
+   */
+  explicit JsonIOBackend(Conversion conversion = Conversion::EAGER) : conversion_(conversion) {}
+
+  bool readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const override;
+  bool readAndAddParametersFromString(const std::string& input_string, ParameterInterface& parameter_interface) const override;
+  bool writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const override;
+  bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& output_string) const override;
+
+private:
+  Conversion conversion_;
+};
+}  // namespace paraminf
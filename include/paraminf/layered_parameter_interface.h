@@ -0,0 +1,162 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The LayeredParameterInterface class stacks several parameter interfaces, e.g. defaults, site and robot specific parameters,
+ * without copying them.
+ * @details Parameters are resolved top-down, i.e. a parameter of an upper layer shadows parameters with the same name in all layers
+ * below. Resolved layers are cached per parameter name. A change of a layer only invalidates the cached entries that may be affected by
+ * it, which is detected using the version of the layer. Lookups hold an internal lock while querying the layers.
+ */
+class LayeredParameterInterface
+{
+public:
+  /**
+   * @brief Alias for std::shared_ptr
+   */
+  using Ptr = std::shared_ptr<LayeredParameterInterface>;
+
+  /**
+   * @brief Alias for read only std::shared_ptr
+   */
+  using ConstPtr = std::shared_ptr<const LayeredParameterInterface>;
+
+  LayeredParameterInterface() = default;
+
+  /**
+   * @brief Creates a layered parameter interface from the given layers.
+   * @param layers the layers ordered from the bottom (lowest priority) to the top (highest priority)
+   */
+  explicit LayeredParameterInterface(const std::vector<ParameterInterface::ConstPtr>& layers);
+
+  /**
+   * @brief Adds a layer on top of all existing layers s.t. its parameters shadow the parameters of all other layers.
+   * @param layer the parameter interface that should be added as layer
+   */
+  void pushLayer(ParameterInterface::ConstPtr layer);
+
+  /**
+   * @brief Returns the number of layers.
+   * @return number of layers
+   */
+  size_t getLayerCount() const;
+
+  /**
+   * @brief Returns the layer at the given index, where index 0 is the bottom layer.
+   * @param index the index of the layer
+   * @return the layer at the given index
+   */
+  ParameterInterface::ConstPtr getLayer(size_t index) const;
+
+  /**
+   * @brief Tries to retrieve the value for the given parameter name from the top most layer that contains the parameter.
+   * @details The conversion rules of ParameterInterface::getParam() apply.
+   * @param parameter_name the name of the parameter that should be looked up
+   * @param parameter_value the reference to the value that should be overwritten, if the value for the parameter name could be retrived
+   * @return true if the parameter was found and could successfully be retrieved and written to the given reference
+   */
+  template <class ValueType>
+  bool getParam(const std::string& parameter_name, ValueType& parameter_value) const
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    // the parameter may have been removed from the resolved layer in the meantime, which exposes the layers below
+    for (size_t i = resolveLayer(parameter_name); i > 0; i--)
+    {
+      const ParameterInterface& layer = *layers_[i - 1];
+      if (layer.getParam(parameter_name, parameter_value))
+        return true;
+      // a layer containing the parameter with another type still shadows the layers below
+      if (layer.hasParam(parameter_name))
+        return false;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Tries to retrieve the value for the given parameter name from the top most layer that contains the parameter and returns it.
+   * @details If no parameter with the given name and type is found, an exeption is thrown.
+   * @param parameter_name the name of the parameter that should be looked up
+   * @return retrieved parameter value with the given parameter_name
+   */
+  template <class ValueType>
+  ValueType getParam(const std::string& parameter_name) const
+  {
+    ValueType parameter_value;
+    if (!getParam(parameter_name, parameter_value))
+    {
+      throw std::invalid_argument("Parameter \"" + parameter_name + " was not found");
+    }
+    return parameter_value;
+  }
+
+  /**
+   * @brief Querries whether a parameter is available in any layer.
+   * @param parameter_name the name of the parameter that should be checked
+   * @return true, if the parameter is available
+   */
+  bool hasParam(const std::string& parameter_name) const;
+
+  /**
+   * @brief Querries whether the top most layer containing the parameter provides it with the given type.
+   * @param parameter_name the name of the parameter that should be checked
+   * @return true, if the parameter with the given type is available
+   */
+  template <class ValueType>
+  bool hasParamOfType(const std::string& parameter_name) const
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    for (size_t i = resolveLayer(parameter_name); i > 0; i--)
+    {
+      const ParameterInterface& layer = *layers_[i - 1];
+      if (layer.hasParamOfType<ValueType>(parameter_name))
+        return true;
+      if (layer.hasParam(parameter_name))
+        return false;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns a sorted vector with the names of all parameters available in any layer.
+   * @return vector with all parameter names
+   */
+  std::vector<std::string> getAllParameterNames() const;
+
+  /**
+   * @brief Copies the resolved parameters of all layers into a single parameter interface, e.g. to write them to a file.
+   * @return parameter interface containing the resolved parameters
+   */
+  ParameterInterface flatten() const;
+
+private:
+  std::vector<ParameterInterface::ConstPtr> getLayers() const;
+
+  // returns the index of the top most layer containing the parameter plus one or 0 if no layer contains it, s.t. the caller can iterate
+  // the layers from there downwards without copying them, the cache mutex has to be locked by the caller while using the result
+  size_t resolveLayer(const std::string& parameter_name) const;
+
+  // removes all cached resolutions that may have been changed by layers whose version differs from the cached version
+  void invalidateOutdatedResolutions() const;
+
+  std::vector<ParameterInterface::ConstPtr> layers_;
+
+  // guards the layers and the resolution cache
+  mutable std::mutex cache_mutex_;
+
+  // maps parameter names to the depth of the resolved layer counted from the top, names that are not found are not cached, s.t. lookups
+  // of arbitrary names do not grow the index
+  mutable std::unordered_map<std::string, size_t> resolution_index_;
+
+  // versions of the layers when the resolution index was validated the last time
+  mutable std::vector<uint64_t> cached_layer_versions_;
+};
+}  // namespace paraminf
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterCheckpointer class persists a parameter interface to a YAML file on a background thread.
+ * @details Requesting a checkpoint only signals the background thread, which takes a snapshot of the parameters and writes it
+ * to the file. Writes are skipped if the parameters have not been changed since the last write, which is detected using the
+ * version of the parameter interface, and are rate limited by the minimal write interval. Requests arriving while a checkpoint
+ * is pending are coalesced into this checkpoint. The file is replaced atomically by writing to a temporary file first, which is
+ * synced together with its directory before a checkpoint is reported as written. Each written checkpoint copies the parameter map
+ * and the values while holding the read lock of the interface, the interned strings are shared with the copy.
+ */
+class ParameterCheckpointer
+{
+public:
+  /**
+   * @brief Starts the background thread.
+   * @param parameter_interface the parameter interface that should be persisted
+   * @param yaml_file_path path of the file where the parameters should be written
+   * @param min_write_interval minimal time between two consecutive writes
+   */
+  ParameterCheckpointer(ParameterInterface::ConstPtr parameter_interface, const std::string& yaml_file_path,
+                        std::chrono::milliseconds min_write_interval = std::chrono::milliseconds(1000));
+
+  /**
+   * @brief Writes a pending checkpoint without waiting for the minimal write interval and stops the background thread.
+   */
+  ~ParameterCheckpointer();
+
+  ParameterCheckpointer(const ParameterCheckpointer&) = delete;
+  ParameterCheckpointer& operator=(const ParameterCheckpointer&) = delete;
+
+  /**
+   * @brief Requests to persist the current state of the parameters.
+   * @return future that is set once the parameters (at least as recent as when the request was made) have been persisted. Its value
+   * is true if writing has been succesful or was not necessary as nothing changed since the last write.
+   */
+  std::shared_future<bool> requestCheckpoint();
+
+  /**
+   * @brief Returns the number of checkpoints that have actually been written to the file.
+   * @return number of written checkpoints
+   */
+  size_t getWriteCount() const;
+
+private:
+  void run();
+
+  // takes the snapshot and writes it if the parameters changed since the last write
+  bool writeCheckpoint();
+
+  ParameterInterface::ConstPtr parameter_interface_;
+  std::string yaml_file_path_;
+  std::chrono::milliseconds min_write_interval_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+
+  bool stop_ = false;
+  bool checkpoint_pending_ = false;
+  std::promise<bool> pending_promise_;
+  std::shared_future<bool> pending_future_;
+
+  std::optional<uint64_t> written_version_;
+  std::chrono::steady_clock::time_point last_write_time_;
+  size_t write_count_ = 0;
+
+  std::thread worker_thread_;
+};
+}  // namespace paraminf
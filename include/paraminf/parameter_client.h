@@ -0,0 +1,125 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+#include "paraminf/parameter_protocol.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterClient class connects to a ParameterServer via a Unix domain socket.
+ * @details Requests can either be made synchronously, e.g. getParams(), or pipelined by sending several requests with the send*
+ * functions first and collecting their responses afterwards with receiveResponse(). Notifications of subscriptions that arrive while
+ * waiting for a response are queued until they are retrieved with waitForNotification(). A client must only be used by one thread
+ * at a time.
+ */
+class ParameterClient
+{
+public:
+  /**
+   * @brief Connects to the server.
+   * @details Throws std::runtime_error if the connection can not be established.
+   * @param socket_path path of the Unix domain socket of the server
+   */
+  explicit ParameterClient(const std::string& socket_path);
+
+  ~ParameterClient();
+
+  ParameterClient(const ParameterClient&) = delete;
+  ParameterClient& operator=(const ParameterClient&) = delete;
+
+  /**
+   * @brief Requests the values of the given parameters without waiting for the response.
+   * @param parameter_names the names of the requested parameters
+   * @return the id of the request, 0 if sending failed
+   */
+  uint32_t sendGetRequest(const std::vector<std::string>& parameter_names);
+
+  /**
+   * @brief Requests to set all parameters of the given interface without waiting for the response.
+   * @param parameters the parameters that should be set
+   * @return the id of the request, 0 if sending failed or a parameter type is not supported
+   */
+  uint32_t sendSetRequest(const ParameterInterface& parameters);
+
+  /**
+   * @brief Requests the server to load a YAML file without waiting for the response.
+   * @param yaml_file_path the path of the file on the server
+   * @return the id of the request, 0 if sending failed
+   */
+  uint32_t sendLoadFileRequest(const std::string& yaml_file_path);
+
+  /**
+   * @brief Requests to be notified about changes of all parameters starting with the given prefix without waiting for the response.
+   * @param prefix the prefix of the parameter names, an empty prefix subscribes to all parameters
+   * @return the id of the request, 0 if sending failed
+   */
+  uint32_t sendSubscribeRequest(const std::string& prefix);
+
+  /**
+   * @brief Waits for the response of the given request.
+   * @param request_id the id of the request
+   * @param parameters if not null, the parameters returned by a GET request are added to it. Parameters that were not found are skipped.
+   * @return true if the request has been processed succesfully
+   */
+  bool receiveResponse(uint32_t request_id, ParameterInterface* parameters = nullptr);
+
+  /**
+   * @brief Retrieves the values of the given parameters from the server.
+   * @param parameter_names the names of the requested parameters
+   * @param parameters the interface the found parameters are added to
+   * @return true if the request has been processed succesfully
+   */
+  bool getParams(const std::vector<std::string>& parameter_names, ParameterInterface& parameters);
+
+  /**
+   * @brief Sets all parameters of the given interface on the server atomically.
+   * @param parameters the parameters that should be set
+   * @return true if the parameters have been set
+   */
+  bool setParams(const ParameterInterface& parameters);
+
+  /**
+   * @brief Lets the server load a YAML file.
+   * @param yaml_file_path the path of the file on the server
+   * @return true if the file has been loaded
+   */
+  bool loadFile(const std::string& yaml_file_path);
+
+  /**
+   * @brief Subscribes to changes of all parameters starting with the given prefix.
+   * @param prefix the prefix of the parameter names, an empty prefix subscribes to all parameters
+   * @return true if the subscription has been registered
+   */
+  bool subscribe(const std::string& prefix);
+
+  /**
+   * @brief Waits for a notification about changed parameters.
+   * @param changed_parameters the interface the changed parameters are added to
+   * @param timeout maximal time to wait
+   * @return true if a notification has been received within the timeout
+   */
+  bool waitForNotification(ParameterInterface& changed_parameters, std::chrono::milliseconds timeout);
+
+private:
+  uint32_t sendRequest(ParameterProtocol::Opcode opcode, const std::string& payload);
+
+  // reads the next frame from the socket, returns false on timeout or if the connection has been closed
+  bool receiveFrame(ParameterProtocol::Frame& frame, int timeout_milliseconds);
+
+  int file_descriptor_ = -1;
+  uint32_t next_request_id_ = 1;
+
+  std::string input_;
+  size_t input_offset_ = 0;
+
+  std::map<uint32_t, std::vector<std::string>> pending_get_names_;
+  std::map<uint32_t, ParameterProtocol::Frame> received_responses_;
+  std::deque<ParameterProtocol::Frame> received_notifications_;
+};
+}  // namespace paraminf
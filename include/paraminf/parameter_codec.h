@@ -0,0 +1,173 @@
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterCodec class encodes parameter values into a compact binary representation and decodes them again.
+ * @details Each value is encoded as a one byte type tag followed by its payload. Numbers are stored in host byte order, strings and
+ * vectors are prefixed by their size. The representation is therefore only meant to be exchanged between processes on the same
+ * machine, e.g. via shared memory, local sockets or files. The supported types are the types supported by YamlIOHandler.
+ */
+class ParameterCodec
+{
+public:
+  /**
+   * @brief Type tags of the encoded values
+   */
+  enum class TypeTag : uint8_t
+  {
+    INT = 1,
+    DOUBLE,
+    BOOL,
+    STRING,
+    INT_VECTOR,
+    DOUBLE_VECTOR,
+    BOOL_VECTOR,
+    STRING_VECTOR
+  };
+
+  /**
+   * @brief Appends the encoded value of the given parameter to the buffer.
+   * @param parameter_interface the parameter interface containing the parameter
+   * @param parameter_name the name of the parameter that should be encoded
+   * @param buffer the buffer the encoded value is appended to
+   * @return true if the parameter was found and has a supported type
+   */
+  static bool encodeParameter(const ParameterInterface& parameter_interface, const std::string& parameter_name, std::string& buffer);
+
+  /**
+   * @brief Appends the encoded value to the buffer.
+   * @param value the value that should be encoded
+   * @param buffer the buffer the encoded value is appended to
+   * @return true if the value has a supported type
+   */
+  static bool encodeValue(const std::any& value, std::string& buffer);
+
+  /**
+   * @brief Appends the encoded value of a supported type to the buffer.
+   * @param value the value that should be encoded
+   * @param buffer the buffer the encoded value is appended to
+   */
+  template <typename T>
+  static void encode(const T& value, std::string& buffer)
+  {
+    if constexpr (std::is_same_v<T, int>)
+      encodeTagged(TypeTag::INT, value, buffer);
+    else if constexpr (std::is_same_v<T, double>)
+      encodeTagged(TypeTag::DOUBLE, value, buffer);
+    else if constexpr (std::is_same_v<T, bool>)
+      encodeTagged(TypeTag::BOOL, value, buffer);
+    else if constexpr (std::is_same_v<T, std::string>)
+      encodeTagged(TypeTag::STRING, value, buffer);
+    else if constexpr (std::is_same_v<T, std::vector<int>>)
+      encodeTagged(TypeTag::INT_VECTOR, value, buffer);
+    else if constexpr (std::is_same_v<T, std::vector<double>>)
+      encodeTagged(TypeTag::DOUBLE_VECTOR, value, buffer);
+    else if constexpr (std::is_same_v<T, std::vector<bool>>)
+      encodeTagged(TypeTag::BOOL_VECTOR, value, buffer);
+    else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+      encodeTagged(TypeTag::STRING_VECTOR, value, buffer);
+    else
+      static_assert(sizeof(T) == 0, "Type is not supported by the parameter codec");
+  }
+
+  /**
+   * @brief Decodes a value starting at the given offset and advances the offset behind the value.
+   * @param data the encoded data
+   * @param size the size of the encoded data
+   * @param offset the offset of the value within the data
+   * @param value the decoded value
+   * @return true if a valid value has been decoded, false if the data is malformed or truncated
+   */
+  static bool decodeValue(const char* data, size_t size, size_t& offset, std::any& value);
+
+  /**
+   * @brief Appends a size prefixed string to the buffer.
+   * @param value the string that should be appended
+   * @param buffer the buffer the string is appended to
+   */
+  static void encodeString(const std::string& value, std::string& buffer);
+
+  /**
+   * @brief Decodes a size prefixed string starting at the given offset and advances the offset behind the string.
+   * @param data the encoded data
+   * @param size the size of the encoded data
+   * @param offset the offset of the string within the data
+   * @param value the decoded string
+   * @return true if the string has been decoded, false if the data is truncated
+   */
+  static bool decodeString(const char* data, size_t size, size_t& offset, std::string& value);
+
+  /**
+   * @brief Appends a plain number in host byte order to the buffer.
+   * @param value the number that should be appended
+   * @param buffer the buffer the number is appended to
+   */
+  template <typename T>
+  static void encodeNumber(T value, std::string& buffer)
+  {
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic types can be encoded as number");
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  /**
+   * @brief Decodes a plain number starting at the given offset and advances the offset behind the number.
+   * @param data the encoded data
+   * @param size the size of the encoded data
+   * @param offset the offset of the number within the data
+   * @param value the decoded number
+   * @return true if the number has been decoded, false if the data is truncated
+   */
+  template <typename T>
+  static bool decodeNumber(const char* data, size_t size, size_t& offset, T& value)
+  {
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic types can be decoded as number");
+    if (offset > size || size - offset < sizeof(T))
+      return false;
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+private:
+  template <typename T>
+  static void encodeTagged(TypeTag type_tag, const T& value, std::string& buffer)
+  {
+    encodeNumber(static_cast<uint8_t>(type_tag), buffer);
+    encodePayload(value, buffer);
+  }
+
+  template <typename T>
+  static void encodePayload(const T& value, std::string& buffer)
+  {
+    if constexpr (std::is_same_v<T, std::string>)
+      encodeString(value, buffer);
+    else if constexpr (std::is_same_v<T, bool>)
+      encodeNumber(static_cast<uint8_t>(value), buffer);
+    else if constexpr (std::is_arithmetic_v<T>)
+      encodeNumber(value, buffer);
+    else
+    {
+      encodeNumber(static_cast<uint32_t>(value.size()), buffer);
+      for (const auto& element : value)
+      {
+        encodePayload<typename T::value_type>(element, buffer);
+      }
+    }
+  }
+
+  template <typename T>
+  static bool decodePayload(const char* data, size_t size, size_t& offset, T& value);
+
+  template <typename T>
+  static bool decodeTagged(const char* data, size_t size, size_t& offset, std::any& value);
+};
+}  // namespace paraminf
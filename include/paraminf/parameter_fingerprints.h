@@ -0,0 +1,71 @@
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterFingerprints class maintains content hashes of all namespaces of a parameter set.
+ * @details The hierarchy given by the '/' separated parameter names is treated as Merkle tree. The fingerprint of a parameter is the
+ * hash of its type and value, the fingerprint of a namespace is derived from the sum of the hashes of the names and fingerprints of
+ * its direct children. As the sum does not depend on the order of the children, an update only has to adjust the namespaces on the
+ * path of the parameter, i.e. it costs O(depth), and querying the fingerprint of a namespace is a single lookup. Fingerprints only
+ * depend on the names relative to the namespace, s.t. equal subtrees in different namespaces have equal fingerprints.
+ * Values of types that are not supported by the YamlIOHandler only contribute their type.
+ */
+class ParameterFingerprints
+{
+public:
+  ParameterFingerprints() = default;
+  ParameterFingerprints(const ParameterFingerprints& other);
+  ParameterFingerprints& operator=(const ParameterFingerprints& other);
+
+  /**
+   * @brief Updates the fingerprints of all namespaces containing the parameter.
+   * @param parameter_name name of the parameter
+   * @param old_value previous value of the parameter or nullptr if the parameter has been added
+   * @param new_value new value of the parameter or nullptr if the parameter has been removed
+   */
+  void update(std::string_view parameter_name, const std::any* old_value, const std::any* new_value);
+
+  /**
+   * @brief Returns the fingerprint of the namespace.
+   * @param name_space the namespace, an empty string refers to the root namespace
+   * @return the fingerprint of the namespace or 0 if it does not contain any parameter
+   */
+  uint64_t getFingerprint(std::string_view name_space) const;
+
+  /**
+   * @brief Removes all fingerprints.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the hash of the type and value, which does not depend on the string pool the strings are interned in.
+   * @param value the value that should be hashed
+   * @return the hash of the value
+   */
+  static uint64_t hashValue(const std::any& value);
+
+private:
+  struct Node
+  {
+    std::string name_space;
+    uint64_t children_sum = 0;
+    size_t parameter_count = 0;
+  };
+
+  static uint64_t nodeFingerprint(const Node& node);
+
+  // hash of the child entry in its namespace, which binds the fingerprint of the child to its name
+  static uint64_t childHash(std::string_view token, uint64_t child_fingerprint);
+
+  // the keys reference the namespace stored in the node, s.t. lookups do not need to copy the namespace
+  std::unordered_map<std::string_view, std::unique_ptr<Node>> nodes_;
+};
+}  // namespace paraminf
@@ -3,15 +3,32 @@
 #include <memory>
 #include <vector>
 #include <any>
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <mutex>
+#include <shared_mutex>
 #include <algorithm>
 #include <type_traits>
 #include <stdexcept>
 
+#include "paraminf/parameter_fingerprints.h"
+#include "paraminf/parameter_subscriptions.h"
+#include "paraminf/raw_parameter_value.h"
+#include "paraminf/string_pool.h"
+
 namespace paraminf
 {
 /**
  * @brief The ParameterInterface class can be used for handling and passing parameters of arbitrary types.
+ * @details Parameter names and string values are interned in a StringPool, s.t. each distinct string is stored only once. The pool
+ * can be shared between several interfaces, copies of an interface share the pool of the original. String values can be retrieved
+ * as InternedString, whose comparison only compares the addresses. Values stored as RawParameterValue, e.g. by loading a file with
+ * deferred conversion, are converted to the requested type on access. The nodes of the parameter map are allocated from a memory
+ * resource, which can be an arena shared with the string pool to place a bulk loaded parameter set in a few contiguous blocks.
  */
 class ParameterInterface
 {
@@ -26,6 +43,84 @@ public:
    */
   using ConstPtr = std::shared_ptr<const ParameterInterface>;
 
+  /**
+   * @brief The Transaction class stages parameter updates and removals and publishes all of them at once on commit().
+   * @details Readers of the parameter interface observe either all changes of a committed transaction or none of them.
+   * Changes that have not been committed when the transaction is destroyed are discarded.
+   */
+  class Transaction
+  {
+  public:
+    Transaction(Transaction&&) = default;
+    Transaction& operator=(Transaction&&) = default;
+
+    /**
+     * @brief Stages a parameter entry with the given name and value. It overrides a previously staged removal of the same name.
+     * @param parameter_name the name of the parameter entry that should be created
+     * @param parameter_value the value of the paramter
+     */
+    template <class ValueType>
+    void setParam(const std::string& parameter_name, ValueType parameter_value)
+    {
+      staged_removals_.erase(parameter_name);
+      staged_parameters_.insert_or_assign(parameter_interface_->string_pool_->intern(parameter_name), parameter_interface_->makeStoredValue(std::move(parameter_value)));
+    }
+
+    /**
+     * @brief Stages the removal of the parameter with the given name. It overrides a previously staged value of the same name.
+     * @param parameter_name the name of the parameter that should be removed
+     */
+    void removeParam(const std::string& parameter_name);
+
+    /**
+     * @brief Publishes all staged changes to the parameter interface in one step and clears the transaction afterwards.
+     * @details The update flag of the parameter interface is set once if any change has been staged.
+     */
+    void commit();
+
+    /**
+     * @brief Discards all staged changes.
+     */
+    void discard();
+
+    /**
+     * @brief Returns true if no changes are staged.
+     * @return if no changes are staged
+     */
+    bool empty() const;
+
+  private:
+    friend class ParameterInterface;
+
+    explicit Transaction(ParameterInterface& parameter_interface);
+
+    ParameterInterface* parameter_interface_;
+
+    std::pmr::map<InternedString, std::any, InternedString::Less> staged_parameters_;
+    std::set<std::string> staged_removals_;
+  };
+
+  ParameterInterface();
+
+  /**
+   * @brief Creates an empty parameter interface that interns its names and string values in the given pool.
+   * @param string_pool the pool, which can be shared with other interfaces
+   */
+  explicit ParameterInterface(StringPool::Ptr string_pool);
+
+  /**
+   * @brief Creates an empty parameter interface that interns its names and string values in the given pool and allocates its
+   * parameter map from the given memory resource.
+   * @details The memory resource is shared by copies of the interface and by its transactions, which might be used concurrently, so
+   * it has to be thread safe unless the interface is only used by a single thread, e.g. std::pmr::synchronized_pool_resource.
+   * Values that are too large to be stored inside std::any, e.g. vectors, are still allocated from the global heap.
+   * @param string_pool the pool, which can be shared with other interfaces
+   * @param memory_resource the memory resource of the parameter map
+   */
+  ParameterInterface(StringPool::Ptr string_pool, std::shared_ptr<std::pmr::memory_resource> memory_resource);
+  ParameterInterface(const ParameterInterface& other);
+  ParameterInterface& operator=(const ParameterInterface& other);
+
   virtual ~ParameterInterface() = default;
 
   /**
@@ -69,10 +164,59 @@ public:
   template <class ValueType>
   void setParam(const std::string& parameter_name, ValueType parameter_value)
   {
-    parameter_set_[parameter_name] = parameter_value;
+    // the strings are interned before locking, as the pool is synchronized on its own
+    InternedString interned_name = string_pool_->intern(parameter_name);
+    std::any stored_value = makeStoredValue(std::move(parameter_value));
+
+    ParameterSubscriptions::Batch changes;
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (subscriptions_)
+      subscriptions_->collect(interned_name.view(), changes);
+    if (fingerprints_)
+    {
+      // the existing entry is looked up once for the fingerprints and the assignment
+      ParameterMap::iterator itr = parameter_set_.lower_bound(interned_name);
+      bool exists = itr != parameter_set_.end() && itr->first == interned_name;
+      fingerprints_->update(interned_name.view(), exists ? &itr->second : nullptr, &stored_value);
+      if (exists)
+        itr->second = std::move(stored_value);
+      else
+        parameter_set_.emplace_hint(itr, std::move(interned_name), std::move(stored_value));
+    }
+    else
+      parameter_set_.insert_or_assign(std::move(interned_name), std::move(stored_value));
     has_been_updated_ = true;
+    version_++;
+    lock.unlock();
+    deliverChanges(changes);
   }
 
+  /**
+   * @brief Removes the parameter with the given name.
+   * @param parameter_name the name of the parameter that should be removed
+   * @return true, if the parameter was available and has been removed
+   */
+  bool removeParam(const std::string& parameter_name);
+
+  /**
+   * @brief Starts a transaction which stages multiple parameter updates and removals that are published atomically on commit.
+   * @return the new transaction, which must not outlive the parameter interface
+   */
+  Transaction beginTransaction();
+
+  /**
+   * @brief Adds all parameters of the given parameter interface. Parameters that are already available are overwritten.
+   * @param other the parameter interface whose parameters should be added
+   */
+  void mergeParameters(const ParameterInterface& other);
+
+  /**
+   * @brief Moves all parameters of the given parameter interface into this one. Parameters that are already available are overwritten.
+   * @details The entries of the other interface are relinked instead of copied where possible. The other interface is empty afterwards.
+   * @param other the parameter interface whose parameters should be moved
+   */
+  void mergeParameters(ParameterInterface&& other);
+
   /**
    * @brief Querries whether a parameter is available in the parameter interface.
    * @param parameter_name the name of the parameter that should be checked
@@ -88,9 +232,14 @@ public:
   template <class ValueType>
   bool hasParamOfType(const std::string& parameter_name) const
   {
-    std::map<std::string, std::any>::const_iterator itr = parameter_set_.find(parameter_name);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    ParameterMap::const_iterator itr = parameter_set_.find(parameter_name);
+    if (itr == parameter_set_.end())
+      return false;
+    if (!std::is_same_v<ValueType, RawParameterValue> && isType<RawParameterValue>(itr->second))
+      return isRawValueConvertible<ValueType>(std::any_cast<const RawParameterValue&>(itr->second));
 
-    return itr != parameter_set_.end() && (isType<ValueType>(itr->second) || (std::is_convertible_v<int, ValueType> && isType<int>(itr->second)));
+    return isStoredType<ValueType>(itr->second) || (std::is_convertible_v<int, ValueType> && isType<int>(itr->second));
   }
 
   /**
@@ -99,6 +248,27 @@ public:
    */
   std::vector<std::string> getAllParameterNames() const;
 
+  /**
+   * @brief Copies the parameters into one parameter interface per partition.
+   * @details The partition of a parameter is given by getPartitionNamespace(). The copies share the string pool and the memory
+   * resource of this interface, s.t. the values are copied without interning them again. Selected partitions are looked up by
+   * their name ranges, which skip the nested partitions, s.t. copying them scales with their size instead of the number of parameters.
+   * @param partition_depth maximal number of leading name tokens forming the namespace of a partition
+   * @param selected_partitions namespaces of the partitions that should be copied or nullptr to copy all partitions
+   * @return the non-empty partitions by their namespace
+   */
+  std::map<std::string, ParameterInterface, std::less<>> getPartitions(size_t partition_depth,
+                                                                       const std::set<std::string, std::less<>>* selected_partitions = nullptr) const;
+
+  /**
+   * @brief Returns the namespace of the partition of the parameter, which consists of the first partition_depth tokens of the namespace
+   * of the parameter, e.g. "robot" for "robot/arm/gain" and "" for "rate" with a depth of 1.
+   * @param parameter_name name of the parameter
+   * @param partition_depth maximal number of leading name tokens forming the namespace of a partition
+   * @return the namespace of the partition without trailing '/'
+   */
+  static std::string_view getPartitionNamespace(std::string_view parameter_name, size_t partition_depth);
+
   /**
    * @brief Returns true if any parameter has been added or updated since the instantiation of the parameter interface or the last call of resetUpdateFlag().
    * @details The update flag is set every time setParam() is called
@@ -111,18 +281,156 @@ public:
    */
   void resetUpdateFlag();
 
+  /**
+   * @brief Returns the version of the parameter set, which is incremented by every change of the parameter set.
+   * @details In contrast to the update flag the version is never reset and can therefore be used by several observers
+   * independently, e.g. to invalidate caches.
+   * @return the current version of the parameter set
+   */
+  uint64_t getVersion() const;
+
+  /**
+   * @brief Returns the content hash of the namespace, which is equal for namespaces with equal relative parameter names and values.
+   * @details The fingerprints of all namespaces are computed on the first call and updated incrementally on every change afterwards,
+   * see ParameterFingerprints, s.t. subsequent calls only cost a lookup.
+   * @param name_space the namespace with or without trailing '/', an empty string refers to all parameters
+   * @return the fingerprint of the namespace or 0 if it does not contain any parameter
+   */
+  uint64_t getFingerprint(const std::string& name_space = "") const;
+
+  /**
+   * @brief Registers a callback that is notified with the names of the parameters in the namespace that have been set or removed.
+   * @details Each call of setParam() or removeParam(), each commit and each merge is a write operation, whose changes are delivered
+   * after the lock of the parameter set has been released, s.t. the callback can access the parameters. Synchronous callbacks are
+   * called once per write operation by the writing thread, possibly by several threads at once. Callbacks delivered by the
+   * dispatcher thread receive all changes since their last notification. See ParameterSubscriptions for details. Subscriptions
+   * are not copied with the interface. If a synchronous callback throws, the write operation has already been applied and the other
+   * subscriptions are still notified before the exception is rethrown by the writing function.
+   * @param name_space the namespace with or without trailing '/', which also matches a parameter with exactly this name, an empty
+   * string matches all parameters
+   * @param callback the callback receiving the sorted names of the changed parameters
+   * @param delivery thread calling the callback
+   * @param coalescing_interval time the dispatcher waits after the first change before notifying, ignored for synchronous delivery
+   * @return the id of the subscription
+   */
+  uint64_t subscribe(const std::string& name_space, ParameterSubscriptions::Callback callback,
+                     ParameterSubscriptions::Delivery delivery = ParameterSubscriptions::Delivery::SYNCHRONOUS,
+                     std::chrono::milliseconds coalescing_interval = std::chrono::milliseconds(0));
+
+  /**
+   * @brief Removes the subscription, its pending notifications are discarded.
+   * @details Callbacks of the subscription running on other threads are awaited, see ParameterSubscriptions::unsubscribe().
+   * @param subscription_id the id returned by subscribe()
+   * @return true if the subscription has been found
+   */
+  bool unsubscribe(uint64_t subscription_id);
+
+  /**
+   * @brief Returns the pool in which the names and string values are interned.
+   * @return the string pool
+   */
+  StringPool::Ptr getStringPool() const;
+
+  /**
+   * @brief Returns the memory resource from which the parameter map is allocated.
+   * @return the memory resource
+   */
+  std::shared_ptr<std::pmr::memory_resource> getMemoryResource() const;
+
 private:
+  using ParameterMap = std::pmr::map<InternedString, std::any, InternedString::Less>;
+
   bool has_been_updated_ = false;
 
-  std::map<std::string, std::any> parameter_set_;
+  std::atomic<uint64_t> version_ = 0;
+
+  StringPool::Ptr string_pool_;
+
+  // set on construction and never changed, s.t. it can be read without holding the lock
+  std::shared_ptr<std::pmr::memory_resource> memory_resource_;
+
+  ParameterMap parameter_set_;
+
+  // fingerprints of the namespaces, which are only maintained after they have been queried once
+  mutable std::unique_ptr<ParameterFingerprints> fingerprints_;
+
+  // subscriptions, which are created with the first subscription and never reset afterwards, s.t. they can be used without the lock
+  std::unique_ptr<ParameterSubscriptions> subscriptions_;
+
+  // guards the parameter set and the update flag, readers share the lock while setParam() and commits hold it exclusively
+  mutable std::shared_mutex mutex_;
+
+  void commitTransaction(Transaction& transaction);
+
+  // collects the subscriptions matching the names of the parameters, the lock has to be held by the caller
+  void collectChanges(const ParameterMap& parameters, ParameterSubscriptions::Batch& changes) const;
+
+  // delivers the changes of a write operation, the lock must not be held by the caller
+  void deliverChanges(ParameterSubscriptions::Batch& changes)
+  {
+    if (!changes.empty())
+      subscriptions_->deliver(changes);
+  }
+
+  // updates the fingerprints for the new value of the parameter, a null value denotes the removal, the lock has to be held by the caller
+  void updateFingerprints(const InternedString& parameter_name, const std::any* new_value);
+
+  // moves all entries of the source into the parameter set, the lock has to be held by the caller
+  void mergeParameterSet(ParameterMap& source);
+
+  // interns the names and string values of the entries in the pool of this interface if they belong to another pool
+  ParameterMap internParameterSet(const ParameterMap& source) const;
+
+  // converts strings and string vectors to their interned representation, all other values are stored as they are
+  template <class ValueType>
+  std::any makeStoredValue(ValueType&& parameter_value) const
+  {
+    using DecayedType = std::decay_t<ValueType>;
+    if constexpr (std::is_same_v<DecayedType, std::any>)
+      return internValue(std::move(parameter_value));
+    else if constexpr (std::is_same_v<DecayedType, std::string>)
+      return string_pool_->intern(parameter_value);
+    else if constexpr (std::is_same_v<DecayedType, std::vector<std::string>>)
+      return internVector(parameter_value);
+    else
+      return std::any(std::forward<ValueType>(parameter_value));
+  }
+
+  std::any internValue(std::any&& value) const;
+  std::vector<InternedString> internVector(const std::vector<std::string>& values) const;
 
   template <class ValueType>
   bool getParamImpl(const std::string& parameter_name, ValueType& parameter_value) const
   {
-    std::map<std::string, std::any>::const_iterator itr = parameter_set_.find(parameter_name);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    ParameterMap::const_iterator itr = parameter_set_.find(parameter_name);
     // if the parameter is not found return false
     if (itr == parameter_set_.end())
       return false;
+    // raw values are converted to the querried type
+    else if (!std::is_same_v<ValueType, RawParameterValue> && isType<RawParameterValue>(itr->second))
+      return convertRawValue(std::any_cast<const RawParameterValue&>(itr->second), parameter_value);
+    // strings are stored interned and converted back if a std::string is querried
+    else if constexpr (std::is_same_v<ValueType, std::string>)
+    {
+      if (!isType<InternedString>(itr->second))
+        return false;
+      parameter_value = std::any_cast<const InternedString&>(itr->second).str();
+      return true;
+    }
+    else if constexpr (std::is_same_v<ValueType, std::vector<std::string>>)
+    {
+      if (!isType<std::vector<InternedString>>(itr->second))
+        return false;
+      const auto& interned_values = std::any_cast<const std::vector<InternedString>&>(itr->second);
+      parameter_value.clear();
+      parameter_value.reserve(interned_values.size());
+      for (const auto& interned_value : interned_values)
+      {
+        parameter_value.emplace_back(interned_value.view());
+      }
+      return true;
+    }
     // if the parameter is found and has the querried type set it and return true
     else if (isType<ValueType>(itr->second))
     {
@@ -135,17 +443,65 @@ private:
       if constexpr (std::is_convertible_v<int, ValueType>)
       {
         if (isType<int>(itr->second))
+        {
           parameter_value = static_cast<ValueType>(std::any_cast<int>(itr->second));
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // converts the raw value to the type if supported and falls back to the conversion of int like for stored values otherwise
+  template <typename ValueType>
+  static bool convertRawValue(const RawParameterValue& raw_value, ValueType& parameter_value)
+  {
+    if constexpr (RawParameterValue::isSupportedType<ValueType>())
+    {
+      if (raw_value.convert(parameter_value))
+        return true;
+    }
+    if constexpr (std::is_convertible_v<int, ValueType>)
+    {
+      int int_value;
+      if (raw_value.convert(int_value))
+      {
+        parameter_value = static_cast<ValueType>(int_value);
         return true;
       }
     }
     return false;
   }
 
+  template <typename ValueType>
+  static bool isRawValueConvertible(const RawParameterValue& raw_value)
+  {
+    if constexpr (RawParameterValue::isSupportedType<ValueType>())
+    {
+      if (raw_value.convertTo(typeid(ValueType)).has_value())
+        return true;
+    }
+    if constexpr (std::is_convertible_v<int, ValueType>)
+      return raw_value.convertTo(typeid(int)).has_value();
+    return false;
+  }
+
   template <typename ValueType>
   static bool isType(const std::any& to_check)
   {
     return to_check.type() == typeid(ValueType);
   }
+
+  // checks the type a value would be returned as, i.e. interned strings are considered to be strings
+  template <typename ValueType>
+  static bool isStoredType(const std::any& to_check)
+  {
+    if constexpr (std::is_same_v<ValueType, std::string>)
+      return isType<InternedString>(to_check);
+    else if constexpr (std::is_same_v<ValueType, std::vector<std::string>>)
+      return isType<std::vector<InternedString>>(to_check);
+    else
+      return isType<ValueType>(to_check);
+  }
 };
 }  // namespace paraminf
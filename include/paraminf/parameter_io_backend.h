@@ -0,0 +1,199 @@
+#pragma once
+
+#include <any>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterIOBackend class is the interface for reading and writing parameters in a specific file format.
+ * @details Parameter names are mapped to nested maps by splitting them at '/'. The static helpers implement the flattening and
+ * unflattening that is common to all formats, s.t. every backend maps the same textual values to the same parameter types:
+ * scalars are converted to int, double, bool or string, whichever succeeds first, and sequences to a vector of the first of these
+ * types all of their elements can be converted to.
+ */
+class ParameterIOBackend
+{
+public:
+  /**
+   * @brief Alias for std::shared_ptr
+   */
+  using Ptr = std::shared_ptr<ParameterIOBackend>;
+
+  /**
+   * @brief Alias for read only std::shared_ptr
+   */
+  using ConstPtr = std::shared_ptr<const ParameterIOBackend>;
+
+  /**
+   * @brief The TreeVisitor class receives the parameters of a parameter interface as a tree of nested namespaces.
+   */
+  class TreeVisitor
+  {
+  public:
+    virtual ~TreeVisitor() = default;
+
+    /**
+     * @brief Called when a namespace is entered.
+     * @param key the name of the namespace relative to its parent
+     */
+    virtual void beginNamespace(const std::string& key) = 0;
+
+    /**
+     * @brief Called when the namespace entered last is left.
+     */
+    virtual void endNamespace() = 0;
+
+    /**
+     * @brief Called for each parameter inside the current namespace.
+     * @param key the name of the parameter relative to the current namespace
+     * @param parameter_name the full name of the parameter
+     */
+    virtual void visitParameter(const std::string& key, const std::string& parameter_name) = 0;
+  };
+
+  /**
+   * @brief Determines when the texts of scalars and sequences are converted to their types.
+   */
+  enum class Conversion
+  {
+    EAGER,    ///< converted while loading to the first type that succeeds, see convertScalar() and convertSequence()
+    DEFERRED  ///< stored as RawParameterValue and converted to the type requested by the first access
+  };
+
+  virtual ~ParameterIOBackend() = default;
+
+  /**
+   * @brief Reads the parameters from a file and adds them to the specified interface.
+   * @details The default implementation reads the whole file and passes it to readAndAddParametersFromString().
+   * @param file_path path to the file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @return true if parsing has been succesful
+   */
+  virtual bool readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const;
+
+  /**
+   * @brief Reads the parameters from a string and adds them to the specified interface.
+   * @param input_string the input string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @return true if parsing has been succesful
+   */
+  virtual bool readAndAddParametersFromString(const std::string& input_string, ParameterInterface& parameter_interface) const = 0;
+
+  /**
+   * @brief Writes the parameters of the given parameter interface to a file.
+   * @details The default implementation writes the result of writeParametersToString().
+   * @param file_path path of the file where the parameters should be written
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @return true if writing has been succesful
+   */
+  virtual bool writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const;
+
+  /**
+   * @brief Writes the parameters of the given parameter interface to a string.
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @param output_string the string the parameters are written to
+   * @return true if writing has been succesful
+   */
+  virtual bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& output_string) const = 0;
+
+  /**
+   * @brief Creates the backend matching the extension of the given file, i.e. JSON for ".json" and YAML otherwise.
+   * @param file_path path of the file
+   * @param conversion conversion of the values read by the backend
+   * @return the backend for the file
+   */
+  static Ptr createForFile(const std::string& file_path, Conversion conversion = Conversion::EAGER);
+
+  /**
+   * @brief Converts the text of a scalar to int, double, bool or string, whichever succeeds first.
+   * @details The conversion follows the rules of yaml-cpp: integers may be given in hexadecimal ("0x") or octal (leading "0")
+   * notation, doubles additionally accept ".inf", "-.inf" and ".nan" and bools accept y/n, yes/no, true/false and on/off in
+   * lower case, upper case or capitalized. Trailing whitespace is ignored for numbers.
+   * @param text the text of the scalar
+   * @return the converted value
+   */
+  static std::any convertScalar(std::string_view text);
+
+  /**
+   * @brief Converts the texts of the sequence elements to a vector of int, double, bool or string, whichever all elements can be converted to first.
+   * @param elements the texts of the sequence elements
+   * @return the converted vector
+   */
+  static std::any convertSequence(const std::vector<std::string_view>& elements);
+
+  /**
+   * @brief Passes all parameters of the interface in order of their names as tree of nested namespaces to the visitor.
+   * @param parameter_interface the parameter interface
+   * @param visitor the visitor receiving the tree
+   */
+  static void traverseParameterTree(const ParameterInterface& parameter_interface, TreeVisitor& visitor);
+
+  /**
+   * @brief Passes the names in the given order as tree of nested namespaces to the visitor.
+   * @details The names have to be sorted s.t. names sharing a namespace are consecutive, as returned by ParameterInterface::getAllParameterNames().
+   * @param parameter_names the parameter names
+   * @param visitor the visitor receiving the tree
+   */
+  static void traverseParameterTree(const std::vector<std::string>& parameter_names, TreeVisitor& visitor);
+
+  /**
+   * @brief Calls the function with the value of the parameter cast to its actual type.
+   * @details Throws std::invalid_argument if the parameter is not available or its type is not supported.
+   * @param parameter_interface the parameter interface containing the parameter
+   * @param parameter_name the name of the parameter
+   * @param function a function accepting all supported types
+   */
+  template <typename Function>
+  static void visitParameterValue(const ParameterInterface& parameter_interface, const std::string& parameter_name, Function&& function)
+  {
+    if (parameter_interface.hasParamOfType<int>(parameter_name))
+      function(parameter_interface.getParam<int>(parameter_name));
+    else if (parameter_interface.hasParamOfType<double>(parameter_name))
+      function(parameter_interface.getParam<double>(parameter_name));
+    else if (parameter_interface.hasParamOfType<bool>(parameter_name))
+      function(parameter_interface.getParam<bool>(parameter_name));
+    else if (parameter_interface.hasParamOfType<std::string>(parameter_name))
+      function(parameter_interface.getParam<std::string>(parameter_name));
+    else if (parameter_interface.hasParamOfType<std::vector<int>>(parameter_name))
+      function(parameter_interface.getParam<std::vector<int>>(parameter_name));
+    else if (parameter_interface.hasParamOfType<std::vector<double>>(parameter_name))
+      function(parameter_interface.getParam<std::vector<double>>(parameter_name));
+    else if (parameter_interface.hasParamOfType<std::vector<bool>>(parameter_name))
+      function(parameter_interface.getParam<std::vector<bool>>(parameter_name));
+    else if (parameter_interface.hasParamOfType<std::vector<std::string>>(parameter_name))
+      function(parameter_interface.getParam<std::vector<std::string>>(parameter_name));
+    else
+      throw std::invalid_argument("Parameter \"" + parameter_name + " was not found");
+  }
+
+  /**
+   * @brief Converts the scalar text to an int like yaml-cpp.
+   * @param text the text of the scalar
+   * @param value the converted value
+   * @return true if the text is an int
+   */
+  static bool parseInt(std::string_view text, int& value);
+
+  /**
+   * @brief Converts the scalar text to a double like yaml-cpp.
+   * @param text the text of the scalar
+   * @param value the converted value
+   * @return true if the text is a double
+   */
+  static bool parseDouble(std::string_view text, double& value);
+
+  /**
+   * @brief Converts the scalar text to a bool like yaml-cpp.
+   * @param text the text of the scalar
+   * @param value the converted value
+   * @return true if the text is a bool
+   */
+  static bool parseBool(std::string_view text, bool& value);
+};
+}  // namespace paraminf
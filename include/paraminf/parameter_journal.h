@@ -0,0 +1,160 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "paraminf/parameter_codec.h"
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterJournal class persists single parameter updates by appending them to a binary journal file.
+ * @details Updates made via the journal are applied to the parameter interface and appended as typed records, see ParameterCodec,
+ * which are written and synced to the file in batches by a background thread. Each record is framed by its length and a CRC32
+ * checksum, s.t. a record torn by a crash is detected and dropped on replay. On construction the base snapshot is loaded and the
+ * journal is replayed on top of it. Once the journal exceeds the compaction threshold, the background thread writes the current
+ * parameters as new base snapshot and starts a new journal with the updates that are not contained in the snapshot. The base
+ * snapshot is read and written with the ParameterIOBackend selected by its file extension.
+ */
+class ParameterJournal
+{
+public:
+  /**
+   * @brief Loads the base snapshot and replays the journal into the parameter interface and starts the background thread.
+   * @details A missing base snapshot or journal is treated as empty. A torn record at the end of the journal is truncated.
+   * @param parameter_interface the parameter interface the updates are applied to
+   * @param base_file_path path of the base snapshot
+   * @param journal_file_path path of the journal
+   * @param sync_interval maximal time between an update and the sync of its record to the file
+   * @param compaction_threshold size of the journal in bytes after which it is compacted into a new base, 0 disables compaction
+   * @throws std::runtime_error if the base snapshot can not be read or the journal can not be opened
+   */
+  ParameterJournal(ParameterInterface::Ptr parameter_interface, const std::string& base_file_path, const std::string& journal_file_path,
+                   std::chrono::milliseconds sync_interval = std::chrono::milliseconds(10), size_t compaction_threshold = 16 * 1024 * 1024);
+
+  /**
+   * @brief Syncs all pending records and stops the background thread.
+   */
+  ~ParameterJournal();
+
+  ParameterJournal(const ParameterJournal&) = delete;
+  ParameterJournal& operator=(const ParameterJournal&) = delete;
+
+  /**
+   * @brief Sets the parameter in the parameter interface and appends the update to the journal.
+   * @details The update is persisted with the next batch, use sync() to wait until it is durable. Synchronous subscription callbacks
+   * of the parameter interface may update parameters through the journal as well.
+   * @param parameter_name name of the parameter
+   * @param parameter_value value of the parameter
+   */
+  template <typename T>
+  void setParam(const std::string& parameter_name, const T& parameter_value)
+  {
+    std::string record;
+    ParameterCodec::encode(parameter_value, record);
+    std::lock_guard<std::recursive_mutex> update_lock(update_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      appendRecord(RecordType::SET, parameter_name, record);
+    }
+    parameter_interface_->setParam(parameter_name, parameter_value);
+  }
+
+  /**
+   * @brief Removes the parameter from the parameter interface and appends the removal to the journal.
+   * @param parameter_name name of the parameter
+   * @return true if the parameter has been removed
+   */
+  bool removeParam(const std::string& parameter_name);
+
+  /**
+   * @brief Requests to sync all records appended so far to the file.
+   * @return future that is set once the records have been synced, its value is true if writing has been succesful
+   */
+  std::shared_future<bool> sync();
+
+  /**
+   * @brief Requests to compact the journal into a new base snapshot regardless of the compaction threshold.
+   * @return future that is set once the compaction has been finished, its value is true if it has been succesful
+   */
+  std::shared_future<bool> requestCompaction();
+
+  /**
+   * @brief Returns the number of records that have been replayed on construction.
+   * @return number of replayed records
+   */
+  size_t getReplayedRecordCount() const;
+
+  /**
+   * @brief Returns the size of the journal including the records that have not been written yet.
+   * @return size of the journal in bytes
+   */
+  size_t getJournalSize() const;
+
+  /**
+   * @brief Returns the number of compactions that have been finished.
+   * @return number of compactions
+   */
+  size_t getCompactionCount() const;
+
+  /**
+   * @brief Applies the valid records of the journal file to the parameter interface.
+   * @param journal_file_path path of the journal
+   * @param parameter_interface parameter interface the records are applied to
+   * @param record_count number of applied records
+   * @return size of the valid prefix of the journal in bytes, the remaining bytes are a torn or corrupt tail
+   */
+  static size_t replay(const std::string& journal_file_path, ParameterInterface& parameter_interface, size_t& record_count);
+
+private:
+  enum class RecordType : uint8_t
+  {
+    SET = 1,
+    REMOVE
+  };
+
+  // appends the framed record to the pending buffer, the mutex must be held
+  void appendRecord(RecordType record_type, const std::string& parameter_name, const std::string& encoded_value);
+
+  void run();
+
+  // writes the data to the journal and syncs it
+  bool writeAndSync(const std::string& data);
+
+  // writes a new base snapshot and replaces the journal by the records appended since taking the snapshot
+  bool compact();
+
+  ParameterInterface::Ptr parameter_interface_;
+  std::string base_file_path_;
+  std::string journal_file_path_;
+  std::chrono::milliseconds sync_interval_;
+  size_t compaction_threshold_;
+
+  // orders the records like the updates of the parameter interface, recursive s.t. callbacks of the updates can update parameters
+  std::recursive_mutex update_mutex_;
+
+  // guards the pending records and the state shared with the background thread
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_ = false;
+
+  std::string pending_records_;
+  std::vector<std::promise<bool>> sync_promises_;
+  std::vector<std::promise<bool>> compaction_promises_;
+
+  // size of the journal file and of the journal including the pending records
+  size_t written_size_ = 0;
+  size_t journal_size_ = 0;
+  size_t replayed_record_count_ = 0;
+  size_t compaction_count_ = 0;
+
+  int journal_fd_ = -1;
+  std::thread worker_thread_;
+};
+}  // namespace paraminf
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterProtocol class defines the binary protocol spoken between ParameterServer and ParameterClient.
+ * @details Every message is a frame consisting of the payload size (uint32), the opcode (uint8), the request id (uint32) and the
+ * payload. Requests are answered in the order they were received with a frame carrying the same opcode and request id, whose payload
+ * starts with a status byte. A client can therefore send many requests before reading the responses (pipelining). Notifications for
+ * subscriptions are pushed by the server with the request id 0. Values are encoded with ParameterCodec.
+ *
+ * Payloads of the requests:
+ * - GET: number of names (uint32) followed by the names
+ * - SET: number of parameters (uint32) followed by name and encoded value of each parameter
+ * - LOAD_FILE: path of the YAML file on the server
+ * - SUBSCRIBE: name prefix of the parameters whose changes should be pushed
+ *
+ * The response to GET contains the number of names followed by a found flag (uint8) and, if found, the encoded value for each name.
+ * NOTIFY frames contain the changed parameters in the format of a SET request.
+ */
+class ParameterProtocol
+{
+public:
+  /**
+   * @brief Opcodes of the frames
+   */
+  enum class Opcode : uint8_t
+  {
+    GET = 1,
+    SET,
+    LOAD_FILE,
+    SUBSCRIBE,
+    NOTIFY
+  };
+
+  /**
+   * @brief A decoded frame
+   */
+  struct Frame
+  {
+    /**
+     * @brief opcode of the frame
+     */
+    Opcode opcode;
+
+    /**
+     * @brief id of the request the frame belongs to, 0 for notifications
+     */
+    uint32_t request_id;
+
+    /**
+     * @brief payload of the frame
+     */
+    std::string payload;
+  };
+
+  /**
+   * @brief size of the frame header in bytes
+   */
+  static constexpr size_t HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t);
+
+  /**
+   * @brief maximal accepted payload size, larger frames are treated as protocol error
+   */
+  static constexpr uint32_t MAX_PAYLOAD_SIZE = 64 * 1024 * 1024;
+
+  /**
+   * @brief Appends a frame to the buffer.
+   * @param opcode the opcode of the frame
+   * @param request_id the id of the request
+   * @param payload the payload of the frame
+   * @param buffer the buffer the frame is appended to
+   */
+  static void appendFrame(Opcode opcode, uint32_t request_id, const std::string& payload, std::string& buffer);
+
+  /**
+   * @brief Extracts the frame starting at the given offset if it has been received completely and advances the offset behind it.
+   * @param buffer the received data
+   * @param offset the offset of the frame within the buffer
+   * @param frame the extracted frame
+   * @param error set to true if the frame is malformed
+   * @return true if a complete frame has been extracted
+   */
+  static bool extractFrame(const std::string& buffer, size_t& offset, Frame& frame, bool& error);
+
+  /**
+   * @brief Encodes a list of parameter names as used by GET requests.
+   * @param parameter_names the names that should be encoded
+   * @return the encoded names
+   */
+  static std::string encodeNames(const std::vector<std::string>& parameter_names);
+
+  /**
+   * @brief Decodes a list of parameter names as used by GET requests.
+   * @param payload the encoded names
+   * @param offset the offset of the names within the payload, advanced behind the names
+   * @param parameter_names the decoded names
+   * @return true if the names have been decoded
+   */
+  static bool decodeNames(const std::string& payload, size_t& offset, std::vector<std::string>& parameter_names);
+
+  /**
+   * @brief Encodes all parameters of the interface as used by SET requests and notifications.
+   * @param parameters the parameters that should be encoded
+   * @param payload the buffer the encoded parameters are appended to
+   * @return true if all parameters have a type supported by ParameterCodec
+   */
+  static bool encodeParameters(const ParameterInterface& parameters, std::string& payload);
+
+  /**
+   * @brief Decodes parameters as used by SET requests and notifications and adds them to the interface.
+   * @param payload the encoded parameters
+   * @param offset the offset of the parameters within the payload, advanced behind the parameters
+   * @param parameters the interface the decoded parameters are added to
+   * @return true if the parameters have been decoded
+   */
+  static bool decodeParameters(const std::string& payload, size_t& offset, ParameterInterface& parameters);
+};
+}  // namespace paraminf
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <any>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterSchema class declares the names, types, value ranges, allowed values and defaults of parameters.
+ * @details A schema is compiled once into a lookup table and applied when loading parameters, see YamlIOHandler. Loaded values are
+ * then converted directly to the declared type instead of guessing it, and are validated in a single pass s.t. consumers do not need
+ * to validate them again on every read.
+ */
+class ParameterSchema
+{
+public:
+  /**
+   * @brief Alias for std::shared_ptr
+   */
+  using Ptr = std::shared_ptr<ParameterSchema>;
+
+  /**
+   * @brief Alias for read only std::shared_ptr
+   */
+  using ConstPtr = std::shared_ptr<const ParameterSchema>;
+
+  /**
+   * @brief Parameter types supported by the schema
+   */
+  enum class Type
+  {
+    INT,
+    DOUBLE,
+    BOOL,
+    STRING,
+    INT_VECTOR,
+    DOUBLE_VECTOR,
+    BOOL_VECTOR,
+    STRING_VECTOR
+  };
+
+  /**
+   * @brief Declaration of a single parameter.
+   */
+  struct Entry
+  {
+    /**
+     * @brief type of the parameter
+     */
+    Type type = Type::STRING;
+
+    /**
+     * @brief whether loading fails if the parameter is missing and no default value is given
+     */
+    bool required = false;
+
+    /**
+     * @brief inclusive lower bound of int and double values, applied to each element of vectors
+     */
+    std::optional<double> min;
+
+    /**
+     * @brief inclusive upper bound of int and double values, applied to each element of vectors
+     */
+    std::optional<double> max;
+
+    /**
+     * @brief allowed values of string parameters, applied to each element of vectors, all values are allowed if empty
+     */
+    std::vector<std::string> enum_values;
+
+    /**
+     * @brief value that is set if the parameter is missing, no default is set if empty
+     */
+    std::any default_value;
+  };
+
+  /**
+   * @brief Adds the declaration of a parameter. The default value is validated against the declaration.
+   * @param parameter_name the name of the declared parameter
+   * @param entry the declaration of the parameter
+   * @param error description of the error if the entry is invalid
+   * @return true if the entry is valid and has been added
+   */
+  bool addEntry(const std::string& parameter_name, const Entry& entry, std::string& error);
+
+  /**
+   * @brief Looks up the declaration of a parameter.
+   * @param parameter_name the name of the parameter
+   * @return the declaration or nullptr if the parameter is not declared
+   */
+  const Entry* findEntry(const std::string& parameter_name) const;
+
+  /**
+   * @brief Returns the names of all declared parameters.
+   * @return vector with all declared parameter names
+   */
+  std::vector<std::string> getAllParameterNames() const;
+
+  /**
+   * @brief Checks whether the given value has the declared type and lies within the declared range and allowed values.
+   * @param parameter_name the name of the parameter
+   * @param entry the declaration the value should be checked against
+   * @param value the value to check
+   * @param error description of the violation if the value is invalid
+   * @return true if the value is valid
+   */
+  static bool validate(const std::string& parameter_name, const Entry& entry, const std::any& value, std::string& error);
+
+  /**
+   * @brief Converts the name of a type as used in schema files, e.g. "double" or "string_vector", to the type.
+   * @param type_name the name of the type
+   * @param type the converted type
+   * @return true if the type name is known
+   */
+  static bool typeFromString(const std::string& type_name, Type& type);
+
+  /**
+   * @brief Converts a type to its name as used in schema files.
+   * @param type the type
+   * @return the name of the type
+   */
+  static std::string typeToString(Type type);
+
+private:
+  std::unordered_map<std::string, Entry> entries_;
+};
+}  // namespace paraminf
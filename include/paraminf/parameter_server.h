@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+#include "paraminf/parameter_protocol.h"
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterServer class hosts a parameter interface for local clients connecting via a Unix domain socket.
+ * @details The server handles all connections on a single background thread using poll(). Requests of a connection are processed in
+ * the order they are received, s.t. clients can pipeline batches of requests, see ParameterProtocol. Clients can subscribe to a name
+ * prefix to get the parameters below this prefix pushed whenever their values change due to a SET or LOAD_FILE request. Requests of
+ * a connection are not read while too many responses are pending, and subscribers that fall too far behind are disconnected. Files
+ * requested by LOAD_FILE are parsed by a separate loader thread, s.t. large files do not stall the other connections. The following
+ * requests of the loading connection are processed once the loaded parameters have been applied.
+ */
+class ParameterServer
+{
+public:
+  /**
+   * @brief Binds the socket and starts serving on a background thread.
+   * @details Throws std::runtime_error if the socket can not be created. An existing socket file at the path is replaced.
+   * @param socket_path path of the Unix domain socket
+   * @param parameter_interface the parameter interface that is served
+   */
+  ParameterServer(const std::string& socket_path, ParameterInterface::Ptr parameter_interface);
+
+  /**
+   * @brief Stops serving, closes all connections and removes the socket file.
+   */
+  ~ParameterServer();
+
+  ParameterServer(const ParameterServer&) = delete;
+  ParameterServer& operator=(const ParameterServer&) = delete;
+
+  /**
+   * @brief Returns the served parameter interface.
+   * @return the served parameter interface
+   */
+  ParameterInterface::Ptr getParameterInterface() const;
+
+private:
+  struct Connection
+  {
+    // identifies the connection, as file descriptors are reused after closing
+    uint64_t id = 0;
+    std::string input;
+    std::string output;
+    std::vector<std::string> subscribed_prefixes;
+    // the client has closed the connection, which is closed once the pending output has been sent
+    bool input_closed = false;
+    // a file load of the connection is pending, the following requests are not processed before it has been applied
+    bool loading = false;
+  };
+
+  struct LoadRequest
+  {
+    uint64_t connection_id;
+    uint32_t request_id;
+    std::string file_path;
+  };
+
+  struct LoadResult
+  {
+    uint64_t connection_id;
+    uint32_t request_id;
+    std::unique_ptr<ParameterInterface> updates;
+    bool success;
+  };
+
+  void run();
+
+  // wakes up the poll loop
+  void wakeUp();
+
+  // parses the requested files and hands the parameters over to the poll loop
+  void runLoader();
+
+  // applies the loaded parameters, answers the load requests and processes the requests that followed them
+  void finishLoads(std::vector<LoadResult>& load_results);
+
+  void acceptConnections();
+
+  // reads the available data and processes all complete requests until the pending output exceeds its limit, returns false if the
+  // connection should be closed
+  bool readFromConnection(int file_descriptor, Connection& connection);
+
+  // processes all complete requests of the input, returns false if the input is malformed
+  bool processRequests(Connection& connection);
+
+  // writes as much of the pending output as possible, returns false if the connection should be closed
+  bool writeToConnection(int file_descriptor, Connection& connection);
+
+  void processRequest(Connection& connection, const ParameterProtocol::Frame& request);
+
+  // applies the updates atomically and notifies the subscribers about all parameters whose value changed
+  void applyUpdates(const ParameterInterface& updates);
+
+  std::string socket_path_;
+  ParameterInterface::Ptr parameter_interface_;
+
+  int listen_file_descriptor_ = -1;
+  // the write end is used to wake up the poll loop when stopping or when a file has been loaded
+  int wake_pipe_[2] = { -1, -1 };
+
+  std::map<int, Connection> connections_;
+  uint64_t next_connection_id_ = 1;
+
+  // guards the state shared with the loader thread
+  std::mutex loader_mutex_;
+  std::condition_variable loader_condition_;
+  bool stop_ = false;
+  std::deque<LoadRequest> load_requests_;
+  std::vector<LoadResult> load_results_;
+
+  std::thread server_thread_;
+  std::thread loader_thread_;
+};
+}  // namespace paraminf
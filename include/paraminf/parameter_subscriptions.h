@@ -0,0 +1,163 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace paraminf
+{
+/**
+ * @brief The ParameterSubscriptions class notifies callbacks registered on a namespace about the parameters changed in it.
+ * @details The subscriptions are indexed by their namespace, s.t. matching a changed parameter only looks up the namespaces on
+ * its path, i.e. it costs O(depth) plus the number of matching subscriptions regardless of the number of registered ones. The
+ * changes of one write operation are collected into a Batch while the parameter set is locked and delivered after the lock has
+ * been released, s.t. callbacks can access the parameters. Synchronous subscriptions are notified once per write operation by
+ * the writing thread. Subscriptions delivered by the dispatcher thread accumulate the changed names until they are due, which
+ * coalesces bursts of write operations into a single notification. An exception thrown by a synchronous callback does not prevent
+ * the notification of the other subscriptions, the first one is rethrown by deliver() afterwards. Exceptions thrown by callbacks
+ * called by the dispatcher thread are discarded.
+ */
+class ParameterSubscriptions
+{
+public:
+  /**
+   * @brief Callback receiving the sorted names of the changed parameters.
+   */
+  using Callback = std::function<void(const std::vector<std::string>& changed_parameter_names)>;
+
+  /**
+   * @brief Determines by which thread the callback is called.
+   */
+  enum class Delivery
+  {
+    SYNCHRONOUS,  ///< called by the thread that changed the parameters after each write operation
+    DISPATCHER    ///< called by the dispatcher thread with all changes since the last notification
+  };
+
+private:
+  struct Subscription;
+  struct Node;
+
+public:
+  /**
+   * @brief The Batch class collects the subscriptions matching the changes of a single write operation.
+   */
+  class Batch
+  {
+  public:
+    /**
+     * @brief Returns true if no subscription matched.
+     * @return if no subscription matched
+     */
+    bool empty() const { return entries_.empty(); }
+
+  private:
+    friend class ParameterSubscriptions;
+
+    std::vector<std::pair<std::shared_ptr<Subscription>, std::vector<std::string>>> entries_;
+    // index of the entry of each subscription
+    std::unordered_map<const Subscription*, size_t> entry_indices_;
+  };
+
+  ParameterSubscriptions() = default;
+
+  /**
+   * @brief Stops the dispatcher thread, pending notifications are discarded.
+   */
+  ~ParameterSubscriptions();
+
+  ParameterSubscriptions(const ParameterSubscriptions&) = delete;
+  ParameterSubscriptions& operator=(const ParameterSubscriptions&) = delete;
+
+  /**
+   * @brief Registers the callback for changes of the parameters in the namespace.
+   * @details The dispatcher thread is started with the first subscription delivered by it.
+   * @param name_space the namespace with or without trailing '/', which also matches a parameter with exactly this name, an empty
+   * string matches all parameters
+   * @param callback the callback receiving the changed names
+   * @param delivery thread calling the callback
+   * @param coalescing_interval time the dispatcher waits after the first change before notifying, s.t. the following changes are
+   * delivered with it, ignored for synchronous delivery
+   * @return the id of the subscription
+   */
+  uint64_t subscribe(const std::string& name_space, Callback callback, Delivery delivery = Delivery::SYNCHRONOUS,
+                     std::chrono::milliseconds coalescing_interval = std::chrono::milliseconds(0));
+
+  /**
+   * @brief Removes the subscription, its pending notifications are discarded.
+   * @details Callbacks of the subscription that are running on other threads are awaited, s.t. the resources used by the callback
+   * can be released afterwards. A callback may remove its own subscription, which does not wait for the callback itself then.
+   * @param subscription_id the id returned by subscribe()
+   * @return true if the subscription has been found
+   */
+  bool unsubscribe(uint64_t subscription_id);
+
+  /**
+   * @brief Adds the subscriptions matching the changed parameter to the batch.
+   * @param parameter_name name of the parameter that has been set or removed
+   * @param batch the batch of the write operation
+   */
+  void collect(std::string_view parameter_name, Batch& batch) const;
+
+  /**
+   * @brief Notifies the synchronous subscriptions of the batch and hands the others over to the dispatcher.
+   * @param batch the batch of the write operation, which is empty afterwards
+   * @throws the first exception thrown by a synchronous callback after all subscriptions have been notified
+   */
+  void deliver(Batch& batch);
+
+private:
+  struct Subscription
+  {
+    uint64_t id;
+    Node* node;
+    Callback callback;
+    Delivery delivery;
+    std::chrono::milliseconds coalescing_interval;
+    bool active = true;
+    // threads currently calling the callback, which are awaited by unsubscribe()
+    std::vector<std::thread::id> calling_threads;
+
+    // changes that have not been delivered by the dispatcher yet
+    std::set<std::string> pending_names;
+    std::chrono::steady_clock::time_point due_time;
+  };
+
+  struct Node
+  {
+    std::string name_space;
+    std::vector<std::shared_ptr<Subscription>> subscriptions;
+  };
+
+  // calls the callback of the active subscription, the lock must be held and is released during the call, returns the exception
+  // thrown by the callback if any
+  std::exception_ptr notify(const std::shared_ptr<Subscription>& subscription, const std::vector<std::string>& names, std::unique_lock<std::mutex>& lock);
+
+  void runDispatcher();
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_ = false;
+  // notified whenever a callback has returned
+  std::condition_variable callback_condition_;
+
+  uint64_t next_id_ = 1;
+  std::unordered_map<uint64_t, std::shared_ptr<Subscription>> subscriptions_;
+  // the keys reference the namespace stored in the node, s.t. lookups do not need to copy the namespace
+  std::unordered_map<std::string_view, std::unique_ptr<Node>> nodes_;
+
+  // subscriptions with pending names in the order they became pending
+  std::vector<std::shared_ptr<Subscription>> pending_subscriptions_;
+  std::thread dispatcher_thread_;
+};
+}  // namespace paraminf
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The PartitionedParameterStore class persists a parameter interface as one YAML file per namespace partition.
+ * @details The parameters are partitioned by the first tokens of their namespace, see ParameterInterface::getPartitionNamespace(),
+ * and each partition is written to its own file in the directory. A manifest lists the file of each partition. The store subscribes
+ * to the changes of the parameter interface and marks the partitions of the changed parameters, s.t. saving only copies and writes
+ * these partitions. Partitions whose fingerprint did not change since they have been written or loaded, e.g. because a value has
+ * been set to its previous value, are not rewritten. Each file is replaced atomically by writing to a temporary file first, which
+ * is synced together with the directory before the file is replaced. The manifest is only rewritten if partitions have been added
+ * or removed. Loading reads the partitions in parallel.
+ */
+class PartitionedParameterStore
+{
+public:
+  /**
+   * @brief Reads the manifest if it exists and subscribes to the changes of the parameter interface.
+   * @details All existing parameters and all partitions listed in the manifest are considered as changed, s.t. the next save makes
+   * the directory match the parameter interface.
+   * @param parameter_interface the parameter interface that should be persisted
+   * @param directory_path path of the directory containing the manifest and the partition files, which is created on save
+   * @param partition_depth maximal number of leading name tokens forming the namespace of a partition, 1 partitions by the
+   * top-level namespaces
+   * @param thread_count maximal number of threads reading or writing partitions, 0 selects the number of hardware threads
+   * @throws std::invalid_argument if the parameter interface is null
+   * @throws std::runtime_error if the manifest exists but can not be read
+   */
+  PartitionedParameterStore(ParameterInterface::Ptr parameter_interface, const std::string& directory_path, size_t partition_depth = 1,
+                            size_t thread_count = 0);
+
+  /**
+   * @brief Removes the subscription, unsaved changes are discarded.
+   * @details Notifications of concurrent changes that are still being delivered to the store are awaited.
+   */
+  ~PartitionedParameterStore();
+
+  PartitionedParameterStore(const PartitionedParameterStore&) = delete;
+  PartitionedParameterStore& operator=(const PartitionedParameterStore&) = delete;
+
+  /**
+   * @brief Reads all partitions listed in the manifest in parallel and adds them to the parameter interface.
+   * @details The parameters are only added if all partitions could be read. If the manifest has been written with the partition depth
+   * of the store, the loaded partitions are not rewritten by the next save unless they are changed.
+   * @return true if the manifest and all partitions have been read succesfully
+   */
+  bool load();
+
+  /**
+   * @brief Writes the partitions that have been changed since they have been written or loaded and removes the files of empty partitions.
+   * @details The changed partitions are copied at once, s.t. the written files are consistent with a single version of the parameters.
+   * @return true if wirting has been succesful, the partitions that could not be written are retried by the next call otherwise
+   */
+  bool save();
+
+  /**
+   * @brief Returns the number of partition files that have been written.
+   * @return number of written partition files
+   */
+  size_t getWriteCount() const;
+
+  /**
+   * @brief Returns the path of the manifest in the directory.
+   * @return the path of the manifest
+   */
+  std::string getManifestPath() const;
+
+private:
+  struct Partition
+  {
+    std::string file_name;
+    // fingerprint of the parameters as they have been written or loaded
+    uint64_t fingerprint = 0;
+  };
+
+  // marks the partitions of the changed parameters, called by the subscription
+  void markChanged(const std::vector<std::string>& parameter_names);
+
+  // reads the partitions and the partition depth they have been written with, returns false if the manifest is missing or invalid
+  bool readManifest(std::map<std::string, Partition, std::less<>>& partitions, size_t& partition_depth) const;
+  bool writeManifest(const std::map<std::string, Partition, std::less<>>& partitions) const;
+
+  std::string getFilePath(const std::string& file_name) const;
+
+  ParameterInterface::Ptr parameter_interface_;
+  std::string directory_path_;
+  size_t partition_depth_;
+  size_t thread_count_;
+  uint64_t subscription_id_;
+
+  // serializes loading and saving
+  std::mutex persistence_mutex_;
+
+  // guards the changed partitions, which are marked by the writing threads of the parameter interface
+  mutable std::mutex mutex_;
+  std::set<std::string, std::less<>> changed_partitions_;
+  size_t write_count_ = 0;
+
+  // partitions as listed in the manifest, only accessed while holding the persistence mutex
+  std::map<std::string, Partition, std::less<>> partitions_;
+};
+}  // namespace paraminf
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <any>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace paraminf
+{
+/**
+ * @brief The RawParameterValue class stores the unconverted text of a scalar or sequence, which is converted on access.
+ * @details The texts of a load are appended by a Builder to large blocks shared by all of its raw values, s.t. loading neither
+ * converts the values nor allocates memory for them individually. A raw value is a single pointer to its record in the blocks,
+ * so it is stored inside a std::any without a separate allocation. The blocks are released once the last raw value referencing
+ * them has been destroyed. The requested type determines the conversion, which follows the rules of ParameterIOBackend, e.g. the
+ * text "42" can be retrieved as int, double or string. Each successful conversion is cached per requested type, s.t. the text is
+ * converted at most once per type. The type a value would have been converted to when loading eagerly, i.e. int, double, bool or string,
+ * whichever succeeds first, is returned by resolve().
+ */
+class RawParameterValue
+{
+private:
+  struct Storage;
+  struct Record;
+
+public:
+  /**
+   * @brief The Builder class appends raw values to the blocks shared by all values it creates.
+   * @details A builder must only be used by a single thread, the created values can be used by any thread.
+   */
+  class Builder
+  {
+  public:
+    Builder();
+    ~Builder();
+
+    Builder(const Builder&) = delete;
+    Builder& operator=(const Builder&) = delete;
+
+    /**
+     * @brief Creates a raw scalar with the given text.
+     * @param text the text of the scalar
+     * @return the raw scalar
+     */
+    RawParameterValue addScalar(std::string_view text);
+
+    /**
+     * @brief Creates a raw sequence with the given element texts.
+     * @param elements the texts of the elements
+     * @return the raw sequence
+     */
+    RawParameterValue addSequence(const std::vector<std::string_view>& elements);
+
+  private:
+    // allocates a record with the given data size in the current block
+    Record* allocateRecord(size_t data_size, bool is_sequence);
+
+    Storage* storage_;
+  };
+
+  RawParameterValue(const RawParameterValue& other);
+  RawParameterValue(RawParameterValue&& other) noexcept : record_(other.record_) { other.record_ = nullptr; }
+  ~RawParameterValue();
+
+  RawParameterValue& operator=(const RawParameterValue& other);
+  RawParameterValue& operator=(RawParameterValue&& other) noexcept;
+
+  /**
+   * @brief Returns true if the value is a sequence.
+   * @return if the value is a sequence
+   */
+  bool isSequence() const;
+
+  /**
+   * @brief Returns the text of a scalar.
+   * @return the text of the scalar
+   */
+  std::string_view getText() const;
+
+  /**
+   * @brief Returns the texts of the elements of a sequence.
+   * @return the texts of the elements
+   */
+  std::vector<std::string_view> getElements() const;
+
+  /**
+   * @brief Converts the text to the requested type.
+   * @param value the converted value
+   * @return true if the text could be converted to the type
+   */
+  template <typename T>
+  bool convert(T& value) const
+  {
+    static_assert(isSupportedType<T>(), "Type is not supported by raw parameter values");
+    std::any converted = convertTo(typeid(T));
+    if (!converted.has_value())
+      return false;
+    value = std::any_cast<T&&>(std::move(converted));
+    return true;
+  }
+
+  /**
+   * @brief Converts the text to the requested type.
+   * @param type the requested type, one of the supported types
+   * @return the converted value or an empty value if the text can not be converted to the type
+   */
+  std::any convertTo(const std::type_info& type) const;
+
+  /**
+   * @brief Converts the text to the type it would have been converted to when loading eagerly.
+   * @return the converted value
+   */
+  std::any resolve() const;
+
+  /**
+   * @brief Returns true if raw values can be converted to the type, i.e. for int, double, bool, std::string and vectors of these.
+   */
+  template <typename T>
+  static constexpr bool isSupportedType()
+  {
+    return std::is_same_v<T, int> || std::is_same_v<T, double> || std::is_same_v<T, bool> || std::is_same_v<T, std::string> ||
+           std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<double>> || std::is_same_v<T, std::vector<bool>> ||
+           std::is_same_v<T, std::vector<std::string>>;
+  }
+
+private:
+  // takes over a reference of the storage that has already been counted
+  explicit RawParameterValue(Record* record) : record_(record) {}
+
+  Record* record_;
+};
+}  // namespace paraminf
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+/**
+ * @brief The SharedMemoryParameterStore class shares a parameter set between processes on the same machine via POSIX shared memory.
+ * @details A single writer process creates the store and publishes parameter interfaces to it. Any number of reader processes open
+ * the store and query it like a ParameterInterface. Readers never take a lock: the store is protected by a sequence lock, i.e. a reader
+ * copies the requested value and retries if the writer published in the meantime. Every publish therefore replaces the whole parameter
+ * set atomically. The supported parameter types are the types supported by ParameterCodec. Reads that can not get a consistent copy
+ * within the read timeout, e.g. because the writer died while publishing, fail instead of waiting forever.
+ *
+ * If the writer creates a store with a name that is still in use, the old shared memory segment is unlinked first. Readers that still
+ * have the old segment opened keep reading it and have to open the store again to see the new segment.
+ */
+class SharedMemoryParameterStore
+{
+public:
+  /**
+   * @brief Alias for std::shared_ptr
+   */
+  using Ptr = std::shared_ptr<SharedMemoryParameterStore>;
+
+  /**
+   * @brief Alias for read only std::shared_ptr
+   */
+  using ConstPtr = std::shared_ptr<const SharedMemoryParameterStore>;
+
+  /**
+   * @brief Creates the store as writer. The shared memory segment is removed again when the writer is destroyed.
+   * @details Throws std::runtime_error if the shared memory segment can not be created.
+   * @param name the name of the shared memory segment, which has to start with a slash, e.g. "/robot_parameters"
+   * @param capacity the maximal size of the encoded parameter set in bytes
+   */
+  SharedMemoryParameterStore(const std::string& name, size_t capacity);
+
+  /**
+   * @brief Opens an existing store as reader.
+   * @details Throws std::runtime_error if the shared memory segment does not exist or is not a parameter store.
+   * @param name the name of the shared memory segment
+   * @param read_timeout maximal time a read waits for a publish in progress to finish
+   */
+  explicit SharedMemoryParameterStore(const std::string& name, std::chrono::milliseconds read_timeout = std::chrono::milliseconds(1000));
+
+  ~SharedMemoryParameterStore();
+
+  SharedMemoryParameterStore(const SharedMemoryParameterStore&) = delete;
+  SharedMemoryParameterStore& operator=(const SharedMemoryParameterStore&) = delete;
+
+  /**
+   * @brief Replaces the parameter set of the store with the parameters of the given interface. Only the writer can publish.
+   * @param parameter_interface the parameter interface that should be published
+   * @return true if the parameters have been published, false if a parameter type is not supported or the capacity is exceeded
+   */
+  bool publish(const ParameterInterface& parameter_interface);
+
+  /**
+   * @brief Tries to retrieve the value for the given parameter name and if succesful writes it to the given reference.
+   * @details The conversion rules of ParameterInterface::getParam() apply.
+   * @param parameter_name the name of the parameter that should be looked up
+   * @param parameter_value the reference to the value that should be overwritten, if the value for the parameter name could be retrived
+   * @return true if the parameter was found and could successfully be retrieved and written to the given reference
+   */
+  template <class ValueType>
+  bool getParam(const std::string& parameter_name, ValueType& parameter_value) const
+  {
+    std::any value;
+    if (!readValue(parameter_name, value))
+      return false;
+
+    if (value.type() == typeid(ValueType))
+    {
+      parameter_value = std::any_cast<ValueType>(value);
+      return true;
+    }
+    if constexpr (std::is_convertible_v<int, ValueType>)
+    {
+      if (value.type() == typeid(int))
+      {
+        parameter_value = static_cast<ValueType>(std::any_cast<int>(value));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Tries to retrieve the value for the given parameter name and if succesful returns it.
+   * @details If no parameter with the given name and type is found, an exeption is thrown.
+   * @param parameter_name the name of the parameter that should be looked up
+   * @return retrieved parameter value with the given parameter_name
+   */
+  template <class ValueType>
+  ValueType getParam(const std::string& parameter_name) const
+  {
+    ValueType parameter_value;
+    if (!getParam(parameter_name, parameter_value))
+    {
+      throw std::invalid_argument("Parameter \"" + parameter_name + " was not found");
+    }
+    return parameter_value;
+  }
+
+  /**
+   * @brief Querries whether a parameter is available in the store.
+   * @param parameter_name the name of the parameter that should be checked
+   * @return true, if the parameter is available
+   */
+  bool hasParam(const std::string& parameter_name) const;
+
+  /**
+   * @brief Querries whether a parameter with the given name and type is available in the store.
+   * @param parameter_name the name of the parameter that should be checked
+   * @return true, if the parameter with the given type is available
+   */
+  template <class ValueType>
+  bool hasParamOfType(const std::string& parameter_name) const
+  {
+    ValueType parameter_value;
+    return getParam(parameter_name, parameter_value);
+  }
+
+  /**
+   * @brief Returns a sorted vector with all parameter names available.
+   * @return vector with all parameter names, which is empty if the read timed out
+   */
+  std::vector<std::string> getAllParameterNames() const;
+
+  /**
+   * @brief Copies a consistent snapshot of all parameters of the store into the given interface.
+   * @param parameter_interface the parameter interface the parameters are added to
+   * @return true if a snapshot has been copied, false if the read timed out
+   */
+  bool readAll(ParameterInterface& parameter_interface) const;
+
+  /**
+   * @brief Returns the number of publishes since the store has been created.
+   * @return the version of the parameter set
+   */
+  uint64_t getVersion() const;
+
+private:
+  struct SegmentHeader;
+  struct IndexEntry;
+
+  void map(size_t segment_size, bool writable);
+
+  // waits until no publish is in progress and sets the sequence number at the beginning of the read, returns false if the deadline
+  // passed while a publish was in progress
+  bool beginRead(uint64_t& sequence, std::chrono::steady_clock::time_point deadline) const;
+
+  // returns true if no publish happened since the given sequence number was read
+  bool endRead(uint64_t sequence) const;
+
+  // copies the encoded value of the parameter, the data is validated since it may be modified concurrently
+  bool findEncodedValue(const std::string& parameter_name, std::string& encoded_value) const;
+
+  bool readValue(const std::string& parameter_name, std::any& value) const;
+
+  std::string name_;
+  bool is_writer_;
+  std::chrono::milliseconds read_timeout_{ 1000 };
+  int file_descriptor_ = -1;
+  size_t segment_size_ = 0;
+  void* segment_ = nullptr;
+  SegmentHeader* header_ = nullptr;
+  char* payload_ = nullptr;
+};
+}  // namespace paraminf
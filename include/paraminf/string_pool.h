@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace paraminf
+{
+class InternedString;
+
+/**
+ * @brief The StringPool class stores each distinct string once and hands out InternedString handles referencing it.
+ * @details Each string is stored in a single allocation together with its reference count, the pool itself only keeps an open
+ * addressing table of pointers to the strings. A string is removed from the pool as soon as its last handle is destroyed, so the
+ * pool does not grow with strings that are not used anymore. The pool is thread safe. The strings are allocated from a memory
+ * resource, which is only accessed while holding the lock of the pool, so it does not need to be thread safe itself.
+ */
+class StringPool
+{
+public:
+  /**
+   * @brief Alias for std::shared_ptr
+   */
+  using Ptr = std::shared_ptr<StringPool>;
+
+  /**
+   * @brief Alias for read only std::shared_ptr
+   */
+  using ConstPtr = std::shared_ptr<const StringPool>;
+
+  StringPool();
+
+  /**
+   * @brief Creates an empty pool that allocates its strings from the given memory resource.
+   * @details The resource is kept alive as long as any string of the pool exists.
+   * @param memory_resource the memory resource of the strings
+   */
+  explicit StringPool(std::shared_ptr<std::pmr::memory_resource> memory_resource);
+  ~StringPool();
+
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
+  /**
+   * @brief Returns the handle of the given string, which is added to the pool if it is not yet available.
+   * @details The empty string is not stored, its handle is the default constructed InternedString.
+   * @param value the string that should be interned
+   * @return the handle of the interned string
+   */
+  InternedString intern(std::string_view value);
+
+  /**
+   * @brief Returns the number of distinct strings in the pool.
+   * @return the number of distinct strings
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of bytes used by the strings in the pool including the table of the pool.
+   * @details The heap overhead of the allocations is not included, so the value is a lower bound.
+   * @return the number of used bytes
+   */
+  size_t getMemoryUsage() const;
+
+private:
+  friend class InternedString;
+
+  struct State;
+
+  // header of an interned string, the characters are stored null terminated directly behind it
+  struct Entry
+  {
+    std::atomic<uint32_t> references;
+    uint32_t size;
+    size_t hash;
+    State* state;
+
+    const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+  };
+
+  // drops a reference of the entry and removes the entry from its pool if it has been the last one
+  static void release(Entry* entry);
+
+  State* state_;
+};
+
+/**
+ * @brief The InternedString class is a handle to a string stored once in a StringPool.
+ * @details Handles of equal strings interned in the same pool point to the same storage, so comparing them for equality reduces
+ * to a pointer comparison. The string stays valid as long as any handle to it exists, even if the pool has been destroyed.
+ * A default constructed handle refers to the empty string.
+ */
+class InternedString
+{
+public:
+  /**
+   * @brief Orders handles and strings by their content and allows to look up handles by std::string_view in ordered containers.
+   */
+  struct Less
+  {
+    using is_transparent = void;
+
+    bool operator()(const InternedString& lhs, const InternedString& rhs) const { return lhs.entry_ != rhs.entry_ && lhs.view() < rhs.view(); }
+    bool operator()(const InternedString& lhs, std::string_view rhs) const { return lhs.view() < rhs; }
+    bool operator()(std::string_view lhs, const InternedString& rhs) const { return lhs < rhs.view(); }
+  };
+
+  InternedString() = default;
+  InternedString(const InternedString& other) : entry_(other.entry_) { retain(); }
+  InternedString(InternedString&& other) noexcept : entry_(other.entry_) { other.entry_ = nullptr; }
+  ~InternedString()
+  {
+    if (entry_)
+      StringPool::release(entry_);
+  }
+
+  InternedString& operator=(const InternedString& other)
+  {
+    InternedString copy(other);
+    std::swap(entry_, copy.entry_);
+    return *this;
+  }
+
+  InternedString& operator=(InternedString&& other) noexcept
+  {
+    std::swap(entry_, other.entry_);
+    return *this;
+  }
+
+  /**
+   * @brief Returns a view of the interned string, which is valid as long as the handle exists.
+   * @return the view of the interned string
+   */
+  std::string_view view() const { return entry_ ? std::string_view(entry_->data(), entry_->size) : std::string_view(); }
+
+  /**
+   * @brief Returns a copy of the interned string.
+   * @return the interned string
+   */
+  std::string str() const { return std::string(view()); }
+
+  /**
+   * @brief Returns the null terminated interned string.
+   * @return the null terminated interned string
+   */
+  const char* c_str() const { return entry_ ? entry_->data() : ""; }
+
+  /**
+   * @brief Compares the handles by the address of the interned strings, which is only equivalent to comparing the content if
+   * both strings have been interned in the same pool.
+   */
+  bool operator==(const InternedString& other) const { return entry_ == other.entry_; }
+  bool operator!=(const InternedString& other) const { return entry_ != other.entry_; }
+
+  /**
+   * @brief Returns an address identifying the interned string, which is unique per pool and content.
+   * @return the address of the interned string
+   */
+  const void* get() const { return entry_; }
+
+private:
+  friend class StringPool;
+
+  // takes over a reference that has already been counted
+  explicit InternedString(StringPool::Entry* entry) : entry_(entry) {}
+
+  void retain()
+  {
+    if (entry_)
+      entry_->references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  StringPool::Entry* entry_ = nullptr;
+};
+}  // namespace paraminf
+
+namespace std
+{
+template <>
+struct hash<paraminf::InternedString>
+{
+  size_t operator()(const paraminf::InternedString& value) const { return std::hash<const void*>()(value.get()); }
+};
+}  // namespace std
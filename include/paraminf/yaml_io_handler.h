@@ -3,6 +3,8 @@
 #include <yaml-cpp/yaml.h>
 
 #include "paraminf/parameter_interface.h"
+#include "paraminf/parameter_io_backend.h"
+#include "paraminf/parameter_schema.h"
 
 namespace paraminf
 {
@@ -14,20 +16,47 @@ class YamlIOHandler
 public:
   /**
    * @brief Reads the parameters from a YAML file and adds them to the specified interface.
+   * @details Large files are parsed in parallel using all hardware threads, see readAndAddParametersFromString() with thread count.
    * @param yaml_file_path path to the YAML file
    * @param parameter_interface parmeter interface where the parsed parameters should be added
    * @return true if parsing has been succesful
    */
   static bool readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface);
 
+  /**
+   * @brief Reads the parameters from a YAML file using the given number of threads and adds them to the specified interface.
+   * @details See readAndAddParametersFromString() with thread count for details.
+   * @param yaml_file_path path to the YAML file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param thread_count maximal number of threads, 0 selects the number of hardware threads
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface, size_t thread_count);
+
   /**
    * @brief Reads the parameters from a YAML string and adds them to the specified interface.
+   * @details Large inputs are parsed in parallel using all hardware threads, see the overload with thread count.
    * @param yaml_input_string input YAML string
    * @param parameter_interface parmeter interface where the parsed parameters should be added
    * @return true if parsing has been succesful
    */
   static bool readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface);
 
+  /**
+   * @brief Reads the parameters from a YAML string using the given number of threads and adds them to the specified interface.
+   * @details The input is split into chunks at document markers and at the top-level keys of block mappings, which are parsed
+   * concurrently and merged in the order of the input, s.t. later values override earlier ones like when parsing sequentially.
+   * Inputs with directives or chunks that can not be parsed on their own, e.g. because of aliases referring to other chunks, are
+   * parsed by the calling thread as a whole, which results in the same parameters and errors as a single thread. Inputs that are
+   * too small are parsed by the calling thread as well. The chunks share the string pool of the interface, but only the calling thread
+   * allocates from the memory resource of the interface, s.t. it does not need to be thread safe.
+   * @param yaml_input_string input YAML string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param thread_count maximal number of threads, 0 selects the number of hardware threads
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface, size_t thread_count);
+
   /**
    * @brief Reads the parameters from a yaml-cpp node and adds them to the specified interface.
    * @param node yaml-cpp node from which the parameters should be parsed
@@ -36,6 +65,81 @@ public:
    */
   static bool readAndAddParametersFromNode(const YAML::Node& node, ParameterInterface& parameter_interface);
 
+  /**
+   * @brief Reads the parameters from a YAML file with the given conversion and adds them to the specified interface.
+   * @details With deferred conversion the texts of all scalars and sequences of the file are copied into blocks shared by the
+   * RawParameterValue of each parameter and are converted on access. The parameters are only added if the whole file is valid.
+   * @param yaml_file_path path to the YAML file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param conversion conversion of the values
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface, ParameterIOBackend::Conversion conversion);
+
+  /**
+   * @brief Reads the parameters from a YAML string with the given conversion and adds them to the specified interface.
+   * @details See readAndAddParametersFromFile() with conversion for details.
+   * @param yaml_input_string input YAML string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param conversion conversion of the values
+   * @return true if parsing has been succesful
+   */
+  static bool readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface,
+                                             ParameterIOBackend::Conversion conversion);
+
+  /**
+   * @brief Reads the parameters from a YAML file, validates them against the schema and adds them to the specified interface.
+   * @details Declared parameters are converted directly to the declared type. Missing parameters are set to their default value
+   * if they are not yet available in the interface. Parameters that are not declared are added like without schema. The parameters
+   * are only added if no error has been found, otherwise the interface is left unchanged.
+   * @param yaml_file_path path to the YAML file
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param schema the schema the parameters are validated against
+   * @param errors list to which all errors found while reading and validating are appended
+   * @return true if parsing and validation has been succesful
+   */
+  static bool readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface, const ParameterSchema& schema,
+                                           std::vector<std::string>& errors);
+
+  /**
+   * @brief Reads the parameters from a YAML string, validates them against the schema and adds them to the specified interface.
+   * @details See readAndAddParametersFromFile() with schema for details.
+   * @param yaml_input_string input YAML string
+   * @param parameter_interface parmeter interface where the parsed parameters should be added
+   * @param schema the schema the parameters are validated against
+   * @param errors list to which all errors found while reading and validating are appended
+   * @return true if parsing and validation has been succesful
+   */
+  static bool readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface, const ParameterSchema& schema,
+                                             std::vector<std::string>& errors);
+
+  /**
+   * @brief Reads a parameter schema from a YAML file and adds its declarations to the given schema.
+   * @details Each parameter is declared by a map containing the key "type" with one of the type names of ParameterSchema and
+   * optionally the keys "required", "min", "max", "enum" and "default". The declarations can be nested in namespaces like the
+   * parameters themselves, e.g.
+   * \code{.yaml}
+   * controller:
+   *   gain: { type: double, min: 0.0, max: 10.0, default: 1.0 }
+   *   mode: { type: string, enum: [position, velocity], required: true }
+   * \endcode
+   * @param yaml_file_path path to the YAML schema file
+   * @param schema schema to which the declarations should be added
+   * @param errors list to which all errors found in the schema are appended
+   * @return true if the schema is valid
+   */
+  static bool readSchemaFromFile(const std::string& yaml_file_path, ParameterSchema& schema, std::vector<std::string>& errors);
+
+  /**
+   * @brief Reads a parameter schema from a YAML string and adds its declarations to the given schema.
+   * @details See readSchemaFromFile() for the format.
+   * @param yaml_input_string input YAML string
+   * @param schema schema to which the declarations should be added
+   * @param errors list to which all errors found in the schema are appended
+   * @return true if the schema is valid
+   */
+  static bool readSchemaFromString(const std::string& yaml_input_string, ParameterSchema& schema, std::vector<std::string>& errors);
+
   /**
    * @brief Writes the parameters of the given parameter interface to a YAML file.
    * @param yaml_file_path path of the file where the parameters should be written
@@ -44,19 +148,65 @@ public:
    */
   static bool writeParametersToFile(const std::string& yaml_file_path, const ParameterInterface& parameter_interface);
 
+  /**
+   * @brief Writes the parameters of the given parameter interface to a YAML string.
+   * @details Large parameter sets are emitted in parallel using all hardware threads, see the overload with thread count.
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @param yaml_output_string the string the YAML output is written to
+   * @return true if wirting has been succesful
+   */
+  static bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& yaml_output_string);
+
+  /**
+   * @brief Writes the parameters of the given parameter interface to a YAML string using the given number of threads.
+   * @details The sorted parameter names are split into partitions at the boundaries of the top-level namespaces, which are emitted
+   * concurrently and concatenated. The output is identical to the output of a single thread. Parameter sets that are too small
+   * or have only a single top-level namespace are emitted by the calling thread.
+   * @param parameter_interface the parameter interface of which the parameters should be written
+   * @param yaml_output_string the string the YAML output is written to
+   * @param thread_count maximal number of threads, 0 selects the number of hardware threads
+   * @return true if wirting has been succesful
+   */
+  static bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& yaml_output_string, size_t thread_count);
+
 private:
+  class EmitterVisitor;
+
+  // emits the block map of the parameters with the given sorted names
+  static std::string emitParameters(const ParameterInterface& parameter_interface, const std::vector<std::string>& parameter_names);
+
   static void evaluateNode(const YAML::Node& node, const std::string& name_prefix, ParameterInterface& parameter_interface);
+  // adds the parameters of the node, the name is used as buffer for the names of the parameters and restored afterwards
+  static void addNodeParameters(const YAML::Node& node, std::string& name, ParameterInterface& parameter_interface);
 
-  static void readAndAddSingleParameter(const std::string& parameter_name, YAML::Node& value_node, ParameterInterface& parameter_interface);
-  static void readAndAddParameterVector(const std::string& parameter_name, YAML::Node& vector_node, ParameterInterface& parameter_interface);
+  // adds the parameters of the node as raw values created by the builder
+  static void addNodeParametersDeferred(const YAML::Node& node, std::string& name, ParameterInterface::Transaction& transaction,
+                                        RawParameterValue::Builder& builder);
 
-  template <typename T>
-  static bool addSingleParameterIfTypeCorrect(const std::string& parameter_name, YAML::Node& value_node, ParameterInterface& parameter_interface);
-  template <typename T>
-  static bool addParameterVectorIfTypeCorrect(const std::string& parameter_name, YAML::Node& vector_node, ParameterInterface& parameter_interface);
+  static bool readAndAddParametersDeferred(const std::vector<YAML::Node>& parameter_nodes, ParameterInterface& parameter_interface);
+
+  // evaluates the node like evaluateNode(), but converts declared parameters directly and collects errors instead of throwing
+  static void evaluateNodeWithSchema(const YAML::Node& node, const std::string& name_prefix, ParameterInterface& parameter_interface,
+                                     const ParameterSchema& schema, std::vector<std::string>& errors);
+
+  static bool readAndAddParametersWithSchema(const std::vector<YAML::Node>& parameter_nodes, ParameterInterface& parameter_interface,
+                                             const ParameterSchema& schema, std::vector<std::string>& errors);
+
+  static void evaluateSchemaNode(const YAML::Node& node, const std::string& name_prefix, ParameterSchema& schema, std::vector<std::string>& errors);
+
+  // converts the value node to the type declared by the schema entry
+  static bool convertToDeclaredType(const std::string& parameter_name, const YAML::Node& value_node, const ParameterSchema::Entry& entry, std::any& value,
+                                    std::string& error);
+
+  // converts a scalar or sequence node like ParameterIOBackend, throws std::invalid_argument if the node type is not supported
+  static std::any convertValueNode(const std::string& parameter_name, const YAML::Node& value_node);
 
   template <typename T>
   static bool tryParse(YAML::Node node, T& val);
+  template <typename T>
+  static bool tryParseSequence(const YAML::Node& sequence_node, std::vector<T>& values);
+  template <typename T>
+  static bool tryConvert(const YAML::Node& node, std::any& value);
 
   static void setEmitterOptions(YAML::Emitter& yaml_emitter);
 
@@ -79,4 +229,25 @@ private:
    */
   static void appendParameterToYaml(YAML::Emitter& yaml_emitter, const std::string& parameter_name, const ParameterInterface& parameter_interface);
 };
+
+/**
+ * @brief The YamlIOBackend class provides the YamlIOHandler as ParameterIOBackend.
+ */
+class YamlIOBackend : public ParameterIOBackend
+{
+public:
+  /**
+   * @brief Creates the backend.
+   * @param conversion conversion of the values read by the backend
+   */
+  explicit YamlIOBackend(Conversion conversion = Conversion::EAGER) : conversion_(conversion) {}
+
+  bool readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const override;
+  bool readAndAddParametersFromString(const std::string& input_string, ParameterInterface& parameter_interface) const override;
+  bool writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const override;
+  bool writeParametersToString(const ParameterInterface& parameter_interface, std::string& output_string) const override;
+
+private:
+  Conversion conversion_;
+};
 }  // namespace paraminf
@@ -0,0 +1,36 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "file_sync.h"
+
+namespace paraminf
+{
+namespace
+{
+bool syncFileDescriptor(const std::string& file_path, int flags)
+{
+  int fd = open(file_path.c_str(), flags | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+  bool success = fsync(fd) == 0;
+  close(fd);
+  return success;
+}
+}  // namespace
+
+bool syncFile(const std::string& file_path) { return syncFileDescriptor(file_path, O_RDONLY); }
+
+bool syncParentDirectory(const std::string& file_path)
+{
+  size_t separator = file_path.rfind('/');
+  std::string directory = separator == std::string::npos ? "." : separator == 0 ? "/" : file_path.substr(0, separator);
+  return syncFileDescriptor(directory, O_RDONLY | O_DIRECTORY);
+}
+
+bool renameDurably(const std::string& temporary_file_path, const std::string& file_path)
+{
+  return syncFile(temporary_file_path) && std::rename(temporary_file_path.c_str(), file_path.c_str()) == 0 && syncParentDirectory(file_path);
+}
+}  // namespace paraminf
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace paraminf
+{
+// syncs the content of the file to the disk
+bool syncFile(const std::string& file_path);
+
+// syncs the directory containing the file, which makes renames and creations of the file durable
+bool syncParentDirectory(const std::string& file_path);
+
+// syncs the temporary file and renames it to the file path durably, s.t. the file is either the old or the complete new one after a crash
+bool renameDurably(const std::string& temporary_file_path, const std::string& file_path);
+}  // namespace paraminf
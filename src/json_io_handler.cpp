@@ -0,0 +1,597 @@
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+#include "paraminf/json_io_handler.h"
+
+namespace paraminf
+{
+namespace
+{
+constexpr size_t MAX_NESTING_DEPTH = 512;
+
+void appendEscapedString(std::string_view value, std::string& output)
+{
+  static constexpr char hex_digits[] = "0123456789abcdef";
+
+  output.push_back('"');
+  for (char c : value)
+  {
+    switch (c)
+    {
+      case '"':
+        output.append("\\\"");
+        break;
+      case '\\':
+        output.append("\\\\");
+        break;
+      case '\n':
+        output.append("\\n");
+        break;
+      case '\r':
+        output.append("\\r");
+        break;
+      case '\t':
+        output.append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          output.append("\\u00");
+          output.push_back(hex_digits[c >> 4]);
+          output.push_back(hex_digits[c & 0xF]);
+        }
+        else
+          output.push_back(c);
+    }
+  }
+  output.push_back('"');
+}
+
+void appendJsonValue(int value, std::string& output)
+{
+  char buffer[16];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  output.append(buffer, result.ptr);
+}
+
+void appendJsonValue(double value, std::string& output)
+{
+  // JSON has no representation for non-finite numbers, so the YAML notation is written as string
+  if (std::isnan(value))
+  {
+    output.append("\".nan\"");
+    return;
+  }
+  if (std::isinf(value))
+  {
+    output.append(value > 0 ? "\".inf\"" : "\"-.inf\"");
+    return;
+  }
+
+  char buffer[32];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  std::string_view number(buffer, result.ptr - buffer);
+  output.append(number);
+  // enforce ".0" if the double has no decimal fraction in order to be parsed as double if read again
+  if (number.find_first_of(".e") == std::string_view::npos)
+    output.append(".0");
+}
+
+void appendJsonValue(bool value, std::string& output) { output.append(value ? "true" : "false"); }
+
+void appendJsonValue(const std::string& value, std::string& output) { appendEscapedString(value, output); }
+
+template <typename T>
+void appendJsonValue(const std::vector<T>& values, std::string& output)
+{
+  output.push_back('[');
+  for (size_t i = 0; i < values.size(); i++)
+  {
+    if (i > 0)
+      output.append(", ");
+    if constexpr (std::is_same_v<T, bool>)
+      appendJsonValue(static_cast<bool>(values[i]), output);
+    else
+      appendJsonValue(values[i], output);
+  }
+  output.push_back(']');
+}
+
+void appendUtf8(uint32_t code_point, std::string& output)
+{
+  if (code_point < 0x80)
+    output.push_back(static_cast<char>(code_point));
+  else if (code_point < 0x800)
+  {
+    output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+  else if (code_point < 0x10000)
+  {
+    output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+  else
+  {
+    output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+}  // namespace
+
+/**
+ * @brief The Parser class is a recursive descent parser that adds the parameters of a JSON document to a transaction.
+ * @details Strings without escape sequences are referenced in the input directly and all buffers are reused for every token,
+ * s.t. memory is only allocated for the parameter names and values that are added. If a raw value builder is given, the values are
+ * not converted but added as RawParameterValue.
+ */
+class JsonIOHandler::Parser
+{
+public:
+  Parser(std::string_view input, ParameterInterface::Transaction& transaction, RawParameterValue::Builder* raw_value_builder = nullptr)
+    : input_(input), transaction_(transaction), raw_value_builder_(raw_value_builder)
+  {
+  }
+
+  void parseDocument()
+  {
+    skipWhitespace();
+    if (peek() == '{')
+      parseObject(0);
+    else
+      parseValue();  // documents that are not an object contain no parameters, like in YamlIOHandler
+
+    skipWhitespace();
+    if (position_ != input_.size())
+      fail("unexpected content after the document");
+  }
+
+private:
+  // element of an array, referencing either the input or the decoded escaped strings
+  struct ElementSpan
+  {
+    bool is_decoded;
+    size_t begin;
+    size_t length;
+  };
+
+  void parseObject(size_t depth)
+  {
+    if (depth > MAX_NESTING_DEPTH)
+      fail("maximal nesting depth exceeded");
+    expect('{');
+    skipWhitespace();
+    if (consume('}'))
+      return;
+
+    size_t name_prefix_length = name_.size();
+    do
+    {
+      skipWhitespace();
+      name_.append(parseString());
+      skipWhitespace();
+      expect(':');
+      skipWhitespace();
+
+      if (peek() == '{')
+      {
+        name_.push_back('/');
+        parseObject(depth + 1);
+      }
+      else
+      {
+        std::any value = parseValue();
+        if (!value.has_value())
+          fail("null value of parameter \"" + name_ + "\" is not supported");
+        transaction_.setParam(name_, std::move(value));
+      }
+      name_.resize(name_prefix_length);
+      skipWhitespace();
+    } while (consume(','));
+    expect('}');
+  }
+
+  // parses a scalar or array value, returns an empty value for null
+  std::any parseValue()
+  {
+    char c = peek();
+    if (c == '[')
+      return parseArray();
+    if (c == '"')
+      return convertScalar(parseString());
+    if (c == '{')
+      fail("objects are not supported inside arrays");
+
+    std::string_view literal = parseLiteral();
+    if (literal == "null")
+      return std::any();
+    return convertScalar(literal);
+  }
+
+  std::any convertScalar(std::string_view text)
+  {
+    if (!raw_value_builder_)
+      return ParameterIOBackend::convertScalar(text);
+    return raw_value_builder_->addScalar(text);
+  }
+
+  std::any parseArray()
+  {
+    expect('[');
+    element_spans_.clear();
+    decoded_elements_.clear();
+
+    skipWhitespace();
+    if (!consume(']'))
+    {
+      do
+      {
+        skipWhitespace();
+        char c = peek();
+        if (c == '"')
+        {
+          std::string_view element = parseString();
+          if (element.data() == scratch_.data())
+          {
+            element_spans_.push_back({ true, decoded_elements_.size(), element.size() });
+            decoded_elements_.append(element);
+          }
+          else
+            element_spans_.push_back({ false, static_cast<size_t>(element.data() - input_.data()), element.size() });
+        }
+        else if (c == '[' || c == '{')
+          fail("nested arrays and objects inside arrays are not supported");
+        else
+        {
+          std::string_view element = parseLiteral();
+          if (element == "null")
+            fail("null values inside arrays are not supported");
+          element_spans_.push_back({ false, static_cast<size_t>(element.data() - input_.data()), element.size() });
+        }
+        skipWhitespace();
+      } while (consume(','));
+      expect(']');
+    }
+
+    // the views can only be created once all decoded elements are stored, as the buffer might be reallocated before
+    elements_.clear();
+    for (const auto& span : element_spans_)
+    {
+      elements_.push_back(span.is_decoded ? std::string_view(decoded_elements_).substr(span.begin, span.length) : input_.substr(span.begin, span.length));
+    }
+    if (!raw_value_builder_)
+      return ParameterIOBackend::convertSequence(elements_);
+    return raw_value_builder_->addSequence(elements_);
+  }
+
+  // returns the content of the string, which is only valid until the next string is parsed
+  std::string_view parseString()
+  {
+    expect('"');
+    size_t begin = position_;
+    while (position_ < input_.size() && input_[position_] != '"' && input_[position_] != '\\')
+    {
+      if (static_cast<unsigned char>(input_[position_]) < 0x20)
+        fail("control character in string");
+      position_++;
+    }
+    if (position_ >= input_.size())
+      fail("unterminated string");
+    if (input_[position_] == '"')
+      return input_.substr(begin, position_++ - begin);
+
+    // strings with escape sequences are decoded into the scratch buffer
+    scratch_.assign(input_.data() + begin, position_ - begin);
+    while (true)
+    {
+      if (position_ >= input_.size())
+        fail("unterminated string");
+      char c = input_[position_++];
+      if (c == '"')
+        break;
+      if (static_cast<unsigned char>(c) < 0x20)
+        fail("control character in string");
+      if (c != '\\')
+      {
+        scratch_.push_back(c);
+        continue;
+      }
+      if (position_ >= input_.size())
+        fail("unterminated string");
+      switch (input_[position_++])
+      {
+        case '"':
+          scratch_.push_back('"');
+          break;
+        case '\\':
+          scratch_.push_back('\\');
+          break;
+        case '/':
+          scratch_.push_back('/');
+          break;
+        case 'b':
+          scratch_.push_back('\b');
+          break;
+        case 'f':
+          scratch_.push_back('\f');
+          break;
+        case 'n':
+          scratch_.push_back('\n');
+          break;
+        case 'r':
+          scratch_.push_back('\r');
+          break;
+        case 't':
+          scratch_.push_back('\t');
+          break;
+        case 'u':
+        {
+          uint32_t code_point = parseHexQuad();
+          // characters outside of the basic multilingual plane are encoded as surrogate pair
+          if (code_point >= 0xD800 && code_point < 0xDC00 && input_.substr(position_, 2) == "\\u")
+          {
+            position_ += 2;
+            uint32_t low_surrogate = parseHexQuad();
+            if (low_surrogate < 0xDC00 || low_surrogate >= 0xE000)
+              fail("invalid surrogate pair");
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+          }
+          appendUtf8(code_point, scratch_);
+          break;
+        }
+        default:
+          fail("invalid escape sequence");
+      }
+    }
+    return scratch_;
+  }
+
+  uint32_t parseHexQuad()
+  {
+    if (input_.size() - position_ < 4)
+      fail("invalid unicode escape sequence");
+    uint32_t code_point;
+    auto result = std::from_chars(input_.data() + position_, input_.data() + position_ + 4, code_point, 16);
+    if (result.ec != std::errc() || result.ptr != input_.data() + position_ + 4)
+      fail("invalid unicode escape sequence");
+    position_ += 4;
+    return code_point;
+  }
+
+  // parses a number, true, false or null
+  std::string_view parseLiteral()
+  {
+    size_t begin = position_;
+    if (input_.compare(position_, 4, "true") == 0 || input_.compare(position_, 4, "null") == 0)
+      position_ += 4;
+    else if (input_.compare(position_, 5, "false") == 0)
+      position_ += 5;
+    else
+    {
+      // number = [-] (0 | [1-9][0-9]*) [. [0-9]+] [(e|E) [+|-] [0-9]+]
+      consume('-');
+      if (!consume('0') && skipDigits() == 0)
+        fail("invalid value");
+      if (consume('.') && skipDigits() == 0)
+        fail("invalid number");
+      if (consume('e') || consume('E'))
+      {
+        if (!consume('+'))
+          consume('-');
+        if (skipDigits() == 0)
+          fail("invalid number");
+      }
+    }
+    return input_.substr(begin, position_ - begin);
+  }
+
+  size_t skipDigits()
+  {
+    size_t begin = position_;
+    while (position_ < input_.size() && input_[position_] >= '0' && input_[position_] <= '9')
+    {
+      position_++;
+    }
+    return position_ - begin;
+  }
+
+  void skipWhitespace()
+  {
+    while (position_ < input_.size() && (input_[position_] == ' ' || input_[position_] == '\n' || input_[position_] == '\r' || input_[position_] == '\t'))
+    {
+      position_++;
+    }
+  }
+
+  char peek() const { return position_ < input_.size() ? input_[position_] : '\0'; }
+
+  bool consume(char c)
+  {
+    if (peek() != c || position_ >= input_.size())
+      return false;
+    position_++;
+    return true;
+  }
+
+  void expect(char c)
+  {
+    if (!consume(c))
+      fail(std::string("expected '") + c + "'");
+  }
+
+  [[noreturn]] void fail(const std::string& message) const
+  {
+    throw std::invalid_argument("JSON parse error at offset " + std::to_string(position_) + ": " + message);
+  }
+
+  std::string_view input_;
+  size_t position_ = 0;
+  ParameterInterface::Transaction& transaction_;
+
+  // name of the current parameter, namespaces are appended and removed again while descending and ascending
+  std::string name_;
+  std::string scratch_;
+
+  std::vector<ElementSpan> element_spans_;
+  std::string decoded_elements_;
+  std::vector<std::string_view> elements_;
+
+  // creates the raw values if the conversion is deferred
+  RawParameterValue::Builder* raw_value_builder_;
+};
+
+/**
+ * @brief The WriterVisitor class writes the parameter tree as nested JSON objects.
+ */
+class JsonIOHandler::WriterVisitor : public ParameterIOBackend::TreeVisitor
+{
+public:
+  WriterVisitor(std::string& output, const ParameterInterface& parameter_interface) : output_(output), parameter_interface_(parameter_interface) {}
+
+  void beginNamespace(const std::string& key) override
+  {
+    beginMember(key);
+    output_.push_back('{');
+    depth_++;
+    has_members_ = false;
+  }
+
+  void endNamespace() override
+  {
+    depth_--;
+    if (has_members_)
+      newLine();
+    output_.push_back('}');
+    has_members_ = true;
+  }
+
+  void visitParameter(const std::string& key, const std::string& parameter_name) override
+  {
+    beginMember(key);
+    ParameterIOBackend::visitParameterValue(parameter_interface_, parameter_name, [this](const auto& value) { appendJsonValue(value, output_); });
+    has_members_ = true;
+  }
+
+private:
+  void beginMember(const std::string& key)
+  {
+    if (has_members_)
+      output_.push_back(',');
+    newLine();
+    appendEscapedString(key, output_);
+    output_.append(": ");
+  }
+
+  void newLine()
+  {
+    output_.push_back('\n');
+    output_.append(2 * depth_, ' ');
+  }
+
+  std::string& output_;
+  const ParameterInterface& parameter_interface_;
+
+  // the root object is opened by the caller
+  size_t depth_ = 1;
+  bool has_members_ = false;
+};
+
+bool JsonIOHandler::readAndAddParametersFromFile(const std::string& json_file_path, ParameterInterface& parameter_interface)
+{
+  return readAndAddParametersFromFile(json_file_path, parameter_interface, ParameterIOBackend::Conversion::EAGER);
+}
+
+bool JsonIOHandler::readAndAddParametersFromFile(const std::string& json_file_path, ParameterInterface& parameter_interface,
+                                                 ParameterIOBackend::Conversion conversion)
+{
+  std::ifstream input_file(json_file_path, std::ios::binary | std::ios::ate);
+  if (!input_file)
+    return false;
+
+  std::string json_input_string(static_cast<size_t>(input_file.tellg()), '\0');
+  input_file.seekg(0);
+  if (!input_file.read(json_input_string.data(), json_input_string.size()))
+    return false;
+  return readAndAddParametersFromString(json_input_string, parameter_interface, conversion);
+}
+
+bool JsonIOHandler::readAndAddParametersFromString(std::string_view json_input_string, ParameterInterface& parameter_interface)
+{
+  return readAndAddParametersFromString(json_input_string, parameter_interface, ParameterIOBackend::Conversion::EAGER);
+}
+
+bool JsonIOHandler::readAndAddParametersFromString(std::string_view json_input_string, ParameterInterface& parameter_interface,
+                                                   ParameterIOBackend::Conversion conversion)
+{
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  try
+  {
+    if (conversion == ParameterIOBackend::Conversion::DEFERRED)
+    {
+      RawParameterValue::Builder raw_value_builder;
+      Parser(json_input_string, transaction, &raw_value_builder).parseDocument();
+    }
+    else
+      Parser(json_input_string, transaction).parseDocument();
+  }
+  catch (...)
+  {
+    return false;
+  }
+  transaction.commit();
+  return true;
+}
+
+bool JsonIOHandler::writeParametersToFile(const std::string& json_file_path, const ParameterInterface& parameter_interface)
+{
+  std::string json_output_string;
+  if (!writeParametersToString(parameter_interface, json_output_string))
+    return false;
+
+  std::ofstream output_file(json_file_path, std::ios::binary);
+  output_file << json_output_string;
+  return static_cast<bool>(output_file);
+}
+
+bool JsonIOHandler::writeParametersToString(const ParameterInterface& parameter_interface, std::string& json_output_string)
+{
+  try
+  {
+    json_output_string = "{";
+    WriterVisitor visitor(json_output_string, parameter_interface);
+    ParameterIOBackend::traverseParameterTree(parameter_interface, visitor);
+    json_output_string.append(json_output_string.size() > 1 ? "\n}\n" : "}\n");
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool JsonIOBackend::readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const
+{
+  return JsonIOHandler::readAndAddParametersFromFile(file_path, parameter_interface, conversion_);
+}
+
+bool JsonIOBackend::readAndAddParametersFromString(const std::string& input_string, ParameterInterface& parameter_interface) const
+{
+  return JsonIOHandler::readAndAddParametersFromString(input_string, parameter_interface, conversion_);
+}
+
+bool JsonIOBackend::writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const
+{
+  return JsonIOHandler::writeParametersToFile(file_path, parameter_interface);
+}
+
+bool JsonIOBackend::writeParametersToString(const ParameterInterface& parameter_interface, std::string& output_string) const
+{
+  return JsonIOHandler::writeParametersToString(parameter_interface, output_string);
+}
+
+}  // namespace paraminf
@@ -0,0 +1,148 @@
+#include <set>
+#include <limits>
+
+#include "paraminf/layered_parameter_interface.h"
+
+namespace paraminf
+{
+namespace
+{
+constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+}
+
+LayeredParameterInterface::LayeredParameterInterface(const std::vector<ParameterInterface::ConstPtr>& layers)
+{
+  for (const auto& layer : layers)
+  {
+    pushLayer(layer);
+  }
+}
+
+void LayeredParameterInterface::pushLayer(ParameterInterface::ConstPtr layer)
+{
+  if (!layer)
+  {
+    throw std::invalid_argument("Layer of the layered parameter interface must not be null");
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  layers_.push_back(layer);
+  cached_layer_versions_.push_back(layer->getVersion());
+  // the depths of all resolved layers have changed
+  resolution_index_.clear();
+}
+
+size_t LayeredParameterInterface::getLayerCount() const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return layers_.size();
+}
+
+ParameterInterface::ConstPtr LayeredParameterInterface::getLayer(size_t index) const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return layers_.at(index);
+}
+
+bool LayeredParameterInterface::hasParam(const std::string& parameter_name) const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  for (size_t i = resolveLayer(parameter_name); i > 0; i--)
+  {
+    if (layers_[i - 1]->hasParam(parameter_name))
+      return true;
+  }
+  return false;
+}
+
+std::vector<std::string> LayeredParameterInterface::getAllParameterNames() const
+{
+  std::set<std::string> parameter_names;
+  for (const auto& layer : getLayers())
+  {
+    std::vector<std::string> layer_parameter_names = layer->getAllParameterNames();
+    parameter_names.insert(layer_parameter_names.begin(), layer_parameter_names.end());
+  }
+  return std::vector<std::string>(parameter_names.begin(), parameter_names.end());
+}
+
+ParameterInterface LayeredParameterInterface::flatten() const
+{
+  ParameterInterface flattened;
+  for (const auto& layer : getLayers())
+  {
+    flattened.mergeParameters(*layer);
+  }
+  flattened.resetUpdateFlag();
+  return flattened;
+}
+
+std::vector<ParameterInterface::ConstPtr> LayeredParameterInterface::getLayers() const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return layers_;
+}
+
+size_t LayeredParameterInterface::resolveLayer(const std::string& parameter_name) const
+{
+  invalidateOutdatedResolutions();
+
+  size_t depth;
+  auto itr = resolution_index_.find(parameter_name);
+  if (itr != resolution_index_.end())
+  {
+    depth = itr->second;
+  }
+  else
+  {
+    depth = NOT_FOUND;
+    for (size_t i = 0; i < layers_.size(); i++)
+    {
+      if (layers_[layers_.size() - 1 - i]->hasParam(parameter_name))
+      {
+        depth = i;
+        break;
+      }
+    }
+    if (depth == NOT_FOUND)
+      return 0;
+    resolution_index_.emplace(parameter_name, depth);
+  }
+
+  return layers_.size() - depth;
+}
+
+void LayeredParameterInterface::invalidateOutdatedResolutions() const
+{
+  // find the top most changed layer, all resolutions at this depth or below may have changed
+  size_t min_changed_depth = NOT_FOUND;
+  for (size_t i = 0; i < layers_.size(); i++)
+  {
+    uint64_t version = layers_[i]->getVersion();
+    if (version != cached_layer_versions_[i])
+    {
+      cached_layer_versions_[i] = version;
+      min_changed_depth = layers_.size() - 1 - i;
+    }
+  }
+
+  if (min_changed_depth == NOT_FOUND)
+    return;
+
+  if (min_changed_depth == 0)
+  {
+    resolution_index_.clear();
+    return;
+  }
+
+  // parameters resolved above the changed layer are still shadowing it, all others have to be looked up again
+  for (auto itr = resolution_index_.begin(); itr != resolution_index_.end();)
+  {
+    if (itr->second >= min_changed_depth)
+      itr = resolution_index_.erase(itr);
+    else
+      itr++;
+  }
+}
+
+}  // namespace paraminf
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace paraminf
+{
+// returns the given number of threads or the number of hardware threads if it is 0
+inline size_t resolveThreadCount(size_t thread_count) { return thread_count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : thread_count; }
+
+// calls the function for all task indices using up to thread_count threads including the calling thread, 0 selects the number of
+// hardware threads, the tasks are handed out one at a time s.t. tasks of different size are balanced
+template <typename Function>
+void runInParallel(size_t task_count, size_t thread_count, Function&& function)
+{
+  std::atomic<size_t> next_task{ 0 };
+  auto run_tasks = [&]() {
+    for (size_t i = next_task++; i < task_count; i = next_task++)
+    {
+      function(i);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min(resolveThreadCount(thread_count), task_count); i++)
+  {
+    threads.emplace_back(run_tasks);
+  }
+  run_tasks();
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+}  // namespace paraminf
@@ -0,0 +1,97 @@
+#include "paraminf/parameter_checkpointer.h"
+#include "paraminf/yaml_io_handler.h"
+#include "file_sync.h"
+
+namespace paraminf
+{
+ParameterCheckpointer::ParameterCheckpointer(ParameterInterface::ConstPtr parameter_interface, const std::string& yaml_file_path,
+                                             std::chrono::milliseconds min_write_interval)
+  : parameter_interface_(parameter_interface), yaml_file_path_(yaml_file_path), min_write_interval_(min_write_interval)
+{
+  if (!parameter_interface_)
+  {
+    throw std::invalid_argument("Parameter interface of the checkpointer must not be null");
+  }
+  worker_thread_ = std::thread(&ParameterCheckpointer::run, this);
+}
+
+ParameterCheckpointer::~ParameterCheckpointer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_one();
+  worker_thread_.join();
+}
+
+std::shared_future<bool> ParameterCheckpointer::requestCheckpoint()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!checkpoint_pending_)
+  {
+    pending_promise_ = std::promise<bool>();
+    pending_future_ = pending_promise_.get_future().share();
+    checkpoint_pending_ = true;
+    condition_.notify_one();
+  }
+  return pending_future_;
+}
+
+size_t ParameterCheckpointer::getWriteCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return write_count_;
+}
+
+void ParameterCheckpointer::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    condition_.wait(lock, [this] { return checkpoint_pending_ || stop_; });
+    if (!checkpoint_pending_)
+      return;
+
+    // rate limit the writes, but do not delay the last checkpoint when stopping
+    if (write_count_ > 0)
+    {
+      condition_.wait_until(lock, last_write_time_ + min_write_interval_, [this] { return stop_; });
+    }
+
+    std::promise<bool> promise = std::move(pending_promise_);
+    checkpoint_pending_ = false;
+
+    lock.unlock();
+    bool success = writeCheckpoint();
+    promise.set_value(success);
+    lock.lock();
+  }
+}
+
+bool ParameterCheckpointer::writeCheckpoint()
+{
+  // the version is queried before taking the snapshot, s.t. a concurrent change leads to a rewrite on the next request at worst
+  uint64_t version = parameter_interface_->getVersion();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (written_version_ && *written_version_ == version)
+      return true;
+  }
+
+  // the snapshot shares the string pool, s.t. only the map and the values are copied, which keeps the lock of the interface short
+  ParameterInterface snapshot(*parameter_interface_);
+
+  // the checkpoint is only reported as written once it survives a crash
+  std::string temporary_file_path = yaml_file_path_ + ".tmp";
+  if (!YamlIOHandler::writeParametersToFile(temporary_file_path, snapshot) || !renameDurably(temporary_file_path, yaml_file_path_))
+    return false;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  written_version_ = version;
+  last_write_time_ = std::chrono::steady_clock::now();
+  write_count_++;
+  return true;
+}
+
+}  // namespace paraminf
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "paraminf/parameter_client.h"
+#include "paraminf/parameter_codec.h"
+
+namespace paraminf
+{
+ParameterClient::ParameterClient(const std::string& socket_path)
+{
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path))
+    throw std::invalid_argument("Socket path \"" + socket_path + "\" is too long");
+  std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  file_descriptor_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (file_descriptor_ < 0)
+    throw std::runtime_error(std::string("Failed to create socket: ") + std::strerror(errno));
+
+  if (connect(file_descriptor_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+  {
+    std::runtime_error error("Failed to connect to \"" + socket_path + "\": " + std::strerror(errno));
+    close(file_descriptor_);
+    throw error;
+  }
+}
+
+ParameterClient::~ParameterClient() { close(file_descriptor_); }
+
+uint32_t ParameterClient::sendGetRequest(const std::vector<std::string>& parameter_names)
+{
+  uint32_t request_id = sendRequest(ParameterProtocol::Opcode::GET, ParameterProtocol::encodeNames(parameter_names));
+  if (request_id != 0)
+    pending_get_names_[request_id] = parameter_names;
+  return request_id;
+}
+
+uint32_t ParameterClient::sendSetRequest(const ParameterInterface& parameters)
+{
+  std::string payload;
+  if (!ParameterProtocol::encodeParameters(parameters, payload))
+    return 0;
+  return sendRequest(ParameterProtocol::Opcode::SET, payload);
+}
+
+uint32_t ParameterClient::sendLoadFileRequest(const std::string& yaml_file_path) { return sendRequest(ParameterProtocol::Opcode::LOAD_FILE, yaml_file_path); }
+
+uint32_t ParameterClient::sendSubscribeRequest(const std::string& prefix) { return sendRequest(ParameterProtocol::Opcode::SUBSCRIBE, prefix); }
+
+bool ParameterClient::receiveResponse(uint32_t request_id, ParameterInterface* parameters)
+{
+  if (request_id == 0)
+    return false;
+
+  // responses arrive in request order, so responses of earlier requests are kept until they are requested
+  ParameterProtocol::Frame response;
+  auto itr = received_responses_.find(request_id);
+  if (itr != received_responses_.end())
+  {
+    response = std::move(itr->second);
+    received_responses_.erase(itr);
+  }
+  else
+  {
+    while (true)
+    {
+      if (!receiveFrame(response, -1))
+        return false;
+      if (response.opcode == ParameterProtocol::Opcode::NOTIFY)
+        received_notifications_.push_back(std::move(response));
+      else if (response.request_id != request_id)
+        received_responses_[response.request_id] = std::move(response);
+      else
+        break;
+    }
+  }
+
+  // the response of a GET request only contains the values in the order of the requested names
+  std::vector<std::string> parameter_names;
+  auto names_itr = pending_get_names_.find(request_id);
+  if (names_itr != pending_get_names_.end())
+  {
+    parameter_names = std::move(names_itr->second);
+    pending_get_names_.erase(names_itr);
+  }
+
+  const std::string& payload = response.payload;
+  if (payload.empty() || payload[0] == 0)
+    return false;
+  if (response.opcode != ParameterProtocol::Opcode::GET || !parameters)
+    return true;
+
+  size_t offset = 1;
+  uint32_t parameter_count;
+  if (!ParameterCodec::decodeNumber(payload.data(), payload.size(), offset, parameter_count) || parameter_count != parameter_names.size())
+    return false;
+
+  ParameterInterface::Transaction transaction = parameters->beginTransaction();
+  for (uint32_t i = 0; i < parameter_count; i++)
+  {
+    uint8_t found;
+    if (!ParameterCodec::decodeNumber(payload.data(), payload.size(), offset, found))
+      return false;
+    if (!found)
+      continue;
+
+    std::any value;
+    if (!ParameterCodec::decodeValue(payload.data(), payload.size(), offset, value))
+      return false;
+    transaction.setParam(parameter_names[i], value);
+  }
+  transaction.commit();
+  return true;
+}
+
+bool ParameterClient::getParams(const std::vector<std::string>& parameter_names, ParameterInterface& parameters)
+{
+  return receiveResponse(sendGetRequest(parameter_names), &parameters);
+}
+
+bool ParameterClient::setParams(const ParameterInterface& parameters) { return receiveResponse(sendSetRequest(parameters)); }
+
+bool ParameterClient::loadFile(const std::string& yaml_file_path) { return receiveResponse(sendLoadFileRequest(yaml_file_path)); }
+
+bool ParameterClient::subscribe(const std::string& prefix) { return receiveResponse(sendSubscribeRequest(prefix)); }
+
+bool ParameterClient::waitForNotification(ParameterInterface& changed_parameters, std::chrono::milliseconds timeout)
+{
+  ParameterProtocol::Frame notification;
+  if (!received_notifications_.empty())
+  {
+    notification = std::move(received_notifications_.front());
+    received_notifications_.pop_front();
+  }
+  else
+  {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true)
+    {
+      auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+      if (!receiveFrame(notification, std::max<int>(0, remaining.count())))
+        return false;
+      if (notification.opcode == ParameterProtocol::Opcode::NOTIFY)
+        break;
+      received_responses_[notification.request_id] = std::move(notification);
+    }
+  }
+
+  size_t offset = 0;
+  return ParameterProtocol::decodeParameters(notification.payload, offset, changed_parameters);
+}
+
+uint32_t ParameterClient::sendRequest(ParameterProtocol::Opcode opcode, const std::string& payload)
+{
+  uint32_t request_id = next_request_id_++;
+  if (next_request_id_ == 0)
+    next_request_id_ = 1;
+
+  std::string frame;
+  ParameterProtocol::appendFrame(opcode, request_id, payload, frame);
+
+  size_t written = 0;
+  while (written < frame.size())
+  {
+    ssize_t sent = send(file_descriptor_, frame.data() + written, frame.size() - written, MSG_NOSIGNAL);
+    if (sent < 0 && errno == EINTR)
+      continue;
+    if (sent <= 0)
+      return 0;
+    written += sent;
+  }
+  return request_id;
+}
+
+bool ParameterClient::receiveFrame(ParameterProtocol::Frame& frame, int timeout_milliseconds)
+{
+  while (true)
+  {
+    bool error;
+    if (ParameterProtocol::extractFrame(input_, input_offset_, frame, error))
+    {
+      // drop consumed data once it makes up most of the buffer, s.t. pipelined responses do not let it grow without bounds
+      if (input_offset_ == input_.size() || input_offset_ > input_.size() / 2)
+      {
+        input_.erase(0, input_offset_);
+        input_offset_ = 0;
+      }
+      return true;
+    }
+    if (error)
+      return false;
+
+    pollfd poll_file_descriptor = { file_descriptor_, POLLIN, 0 };
+    int ready = poll(&poll_file_descriptor, 1, timeout_milliseconds);
+    if (ready < 0 && errno == EINTR)
+      continue;
+    if (ready <= 0)
+      return false;
+
+    char buffer[65536];
+    ssize_t received = recv(file_descriptor_, buffer, sizeof(buffer), 0);
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received <= 0)
+      return false;
+    input_.append(buffer, received);
+  }
+}
+
+}  // namespace paraminf
@@ -0,0 +1,146 @@
+#include "paraminf/parameter_codec.h"
+
+namespace paraminf
+{
+bool ParameterCodec::encodeParameter(const ParameterInterface& parameter_interface, const std::string& parameter_name, std::string& buffer)
+{
+  if (parameter_interface.hasParamOfType<int>(parameter_name))
+    encode(parameter_interface.getParam<int>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<double>(parameter_name))
+    encode(parameter_interface.getParam<double>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<bool>(parameter_name))
+    encode(parameter_interface.getParam<bool>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<std::string>(parameter_name))
+    encode(parameter_interface.getParam<std::string>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<std::vector<int>>(parameter_name))
+    encode(parameter_interface.getParam<std::vector<int>>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<std::vector<double>>(parameter_name))
+    encode(parameter_interface.getParam<std::vector<double>>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<std::vector<bool>>(parameter_name))
+    encode(parameter_interface.getParam<std::vector<bool>>(parameter_name), buffer);
+  else if (parameter_interface.hasParamOfType<std::vector<std::string>>(parameter_name))
+    encode(parameter_interface.getParam<std::vector<std::string>>(parameter_name), buffer);
+  else
+    return false;
+  return true;
+}
+
+bool ParameterCodec::encodeValue(const std::any& value, std::string& buffer)
+{
+  if (value.type() == typeid(RawParameterValue))
+    return encodeValue(std::any_cast<const RawParameterValue&>(value).resolve(), buffer);
+  if (value.type() == typeid(int))
+    encode(std::any_cast<int>(value), buffer);
+  else if (value.type() == typeid(double))
+    encode(std::any_cast<double>(value), buffer);
+  else if (value.type() == typeid(std::string))
+    encode(std::any_cast<const std::string&>(value), buffer);
+  else if (value.type() == typeid(bool))
+    encode(std::any_cast<bool>(value), buffer);
+  else if (value.type() == typeid(std::vector<int>))
+    encode(std::any_cast<const std::vector<int>&>(value), buffer);
+  else if (value.type() == typeid(std::vector<double>))
+    encode(std::any_cast<const std::vector<double>&>(value), buffer);
+  else if (value.type() == typeid(std::vector<bool>))
+    encode(std::any_cast<const std::vector<bool>&>(value), buffer);
+  else if (value.type() == typeid(std::vector<std::string>))
+    encode(std::any_cast<const std::vector<std::string>&>(value), buffer);
+  else
+    return false;
+  return true;
+}
+
+bool ParameterCodec::decodeValue(const char* data, size_t size, size_t& offset, std::any& value)
+{
+  uint8_t type_tag;
+  if (!decodeNumber(data, size, offset, type_tag))
+    return false;
+
+  switch (static_cast<TypeTag>(type_tag))
+  {
+    case TypeTag::INT:
+      return decodeTagged<int>(data, size, offset, value);
+    case TypeTag::DOUBLE:
+      return decodeTagged<double>(data, size, offset, value);
+    case TypeTag::BOOL:
+      return decodeTagged<bool>(data, size, offset, value);
+    case TypeTag::STRING:
+      return decodeTagged<std::string>(data, size, offset, value);
+    case TypeTag::INT_VECTOR:
+      return decodeTagged<std::vector<int>>(data, size, offset, value);
+    case TypeTag::DOUBLE_VECTOR:
+      return decodeTagged<std::vector<double>>(data, size, offset, value);
+    case TypeTag::BOOL_VECTOR:
+      return decodeTagged<std::vector<bool>>(data, size, offset, value);
+    case TypeTag::STRING_VECTOR:
+      return decodeTagged<std::vector<std::string>>(data, size, offset, value);
+    default:
+      return false;
+  }
+}
+
+void ParameterCodec::encodeString(const std::string& value, std::string& buffer)
+{
+  encodeNumber(static_cast<uint32_t>(value.size()), buffer);
+  buffer.append(value);
+}
+
+bool ParameterCodec::decodeString(const char* data, size_t size, size_t& offset, std::string& value)
+{
+  uint32_t string_size;
+  if (!decodeNumber(data, size, offset, string_size) || size - offset < string_size)
+    return false;
+  value.assign(data + offset, string_size);
+  offset += string_size;
+  return true;
+}
+
+template <typename T>
+bool ParameterCodec::decodePayload(const char* data, size_t size, size_t& offset, T& value)
+{
+  if constexpr (std::is_same_v<T, std::string>)
+  {
+    return decodeString(data, size, offset, value);
+  }
+  else if constexpr (std::is_same_v<T, bool>)
+  {
+    uint8_t byte;
+    if (!decodeNumber(data, size, offset, byte))
+      return false;
+    value = byte != 0;
+    return true;
+  }
+  else if constexpr (std::is_arithmetic_v<T>)
+  {
+    return decodeNumber(data, size, offset, value);
+  }
+  else
+  {
+    uint32_t element_count;
+    // every element occupies at least one byte, which bounds the allocation for malformed data
+    if (!decodeNumber(data, size, offset, element_count) || size - offset < element_count)
+      return false;
+    value.clear();
+    value.reserve(element_count);
+    for (uint32_t i = 0; i < element_count; i++)
+    {
+      typename T::value_type element;
+      if (!decodePayload(data, size, offset, element))
+        return false;
+      value.push_back(element);
+    }
+    return true;
+  }
+}
+
+template <typename T>
+bool ParameterCodec::decodeTagged(const char* data, size_t size, size_t& offset, std::any& value)
+{
+  T decoded_value;
+  if (!decodePayload(data, size, offset, decoded_value))
+    return false;
+  value = std::move(decoded_value);
+  return true;
+}
+
+}  // namespace paraminf
@@ -0,0 +1,220 @@
+#include <cstring>
+#include <typeindex>
+#include <vector>
+
+#include "paraminf/parameter_fingerprints.h"
+#include "paraminf/raw_parameter_value.h"
+#include "paraminf/string_pool.h"
+
+namespace paraminf
+{
+namespace
+{
+// finalizer of splitmix64, which spreads small differences of the input over all bits
+uint64_t mix(uint64_t value)
+{
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31);
+}
+
+// FNV-1a over the bytes of the values
+class Hasher
+{
+public:
+  explicit Hasher(uint64_t seed) : state_(0xcbf29ce484222325ull ^ mix(seed)) {}
+
+  void addBytes(const void* data, size_t size)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      state_ = (state_ ^ bytes[i]) * 0x100000001b3ull;
+    }
+  }
+
+  template <typename T>
+  void add(const T& value)
+  {
+    if constexpr (std::is_same_v<T, InternedString>)
+      add(value.view());
+    else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+    {
+      // the size is added to separate consecutive strings
+      add<uint64_t>(value.size());
+      addBytes(value.data(), value.size());
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+      add<uint8_t>(value);
+    else if constexpr (std::is_same_v<T, double>)
+    {
+      // -0.0 equals 0.0 and therefore has the same hash
+      double normalized = value == 0.0 ? 0.0 : value;
+      addBytes(&normalized, sizeof(double));
+    }
+    else
+      addBytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void addSequence(const std::vector<T>& values)
+  {
+    add<uint64_t>(values.size());
+    for (const auto& value : values)
+    {
+      add<T>(value);
+    }
+  }
+
+  uint64_t finish() const { return mix(state_); }
+
+private:
+  uint64_t state_;
+};
+
+// the same tags are used for std::string and InternedString, s.t. the hash does not depend on how the value is stored
+enum class ValueTag : uint64_t
+{
+  INT = 1,
+  DOUBLE,
+  BOOL,
+  STRING,
+  INT_VECTOR,
+  DOUBLE_VECTOR,
+  BOOL_VECTOR,
+  STRING_VECTOR,
+  OTHER
+};
+
+template <typename T>
+uint64_t hashScalar(ValueTag tag, const std::any& value)
+{
+  Hasher hasher(static_cast<uint64_t>(tag));
+  hasher.add<T>(std::any_cast<const T&>(value));
+  return hasher.finish();
+}
+
+template <typename T>
+uint64_t hashSequence(ValueTag tag, const std::any& value)
+{
+  Hasher hasher(static_cast<uint64_t>(tag));
+  hasher.addSequence<T>(std::any_cast<const std::vector<T>&>(value));
+  return hasher.finish();
+}
+}  // namespace
+
+ParameterFingerprints::ParameterFingerprints(const ParameterFingerprints& other) { *this = other; }
+
+ParameterFingerprints& ParameterFingerprints::operator=(const ParameterFingerprints& other)
+{
+  if (this == &other)
+    return *this;
+  nodes_.clear();
+  nodes_.reserve(other.nodes_.size());
+  for (const auto& entry : other.nodes_)
+  {
+    auto node = std::make_unique<Node>(*entry.second);
+    std::string_view key = node->name_space;
+    nodes_.emplace(key, std::move(node));
+  }
+  return *this;
+}
+
+void ParameterFingerprints::update(std::string_view parameter_name, const std::any* old_value, const std::any* new_value)
+{
+  if (!old_value && !new_value)
+    return;
+
+  // the contributions of the child to its namespace before and after the update, starting with the parameter itself
+  size_t separator = parameter_name.rfind('/');
+  std::string_view token = separator == std::string_view::npos ? parameter_name : parameter_name.substr(separator + 1);
+  std::string_view name_space = separator == std::string_view::npos ? std::string_view() : parameter_name.substr(0, separator);
+  uint64_t old_contribution = old_value ? childHash(token, hashValue(*old_value)) : 0;
+  uint64_t new_contribution = new_value ? childHash(token, hashValue(*new_value)) : 0;
+  int64_t count_difference = static_cast<int64_t>(new_value != nullptr) - static_cast<int64_t>(old_value != nullptr);
+
+  while (true)
+  {
+    auto itr = nodes_.find(name_space);
+    if (itr == nodes_.end())
+    {
+      auto new_node = std::make_unique<Node>();
+      new_node->name_space = name_space;
+      std::string_view key = new_node->name_space;
+      itr = nodes_.emplace(key, std::move(new_node)).first;
+    }
+    Node& node = *itr->second;
+    bool existed = node.parameter_count > 0;
+    uint64_t old_fingerprint = nodeFingerprint(node);
+
+    // the sum wraps around, which keeps it independent of the order of the updates
+    node.children_sum += new_contribution - old_contribution;
+    node.parameter_count += count_difference;
+    bool exists = node.parameter_count > 0;
+    uint64_t new_fingerprint = nodeFingerprint(node);
+    if (!exists)
+      nodes_.erase(itr);
+
+    if (name_space.empty())
+      break;
+
+    separator = name_space.rfind('/');
+    token = separator == std::string_view::npos ? name_space : name_space.substr(separator + 1);
+    name_space = separator == std::string_view::npos ? std::string_view() : name_space.substr(0, separator);
+    old_contribution = existed ? childHash(token, old_fingerprint) : 0;
+    new_contribution = exists ? childHash(token, new_fingerprint) : 0;
+  }
+}
+
+uint64_t ParameterFingerprints::getFingerprint(std::string_view name_space) const
+{
+  if (!name_space.empty() && name_space.back() == '/')
+    name_space.remove_suffix(1);
+  auto itr = nodes_.find(name_space);
+  return itr == nodes_.end() ? 0 : nodeFingerprint(*itr->second);
+}
+
+void ParameterFingerprints::clear() { nodes_.clear(); }
+
+uint64_t ParameterFingerprints::hashValue(const std::any& value)
+{
+  const std::type_info& type = value.type();
+  // raw values have the same hash as if they had been converted when loading
+  if (type == typeid(RawParameterValue))
+    return hashValue(std::any_cast<const RawParameterValue&>(value).resolve());
+  if (type == typeid(int))
+    return hashScalar<int>(ValueTag::INT, value);
+  if (type == typeid(double))
+    return hashScalar<double>(ValueTag::DOUBLE, value);
+  if (type == typeid(bool))
+    return hashScalar<bool>(ValueTag::BOOL, value);
+  if (type == typeid(InternedString))
+    return hashScalar<InternedString>(ValueTag::STRING, value);
+  if (type == typeid(std::string))
+    return hashScalar<std::string>(ValueTag::STRING, value);
+  if (type == typeid(std::vector<int>))
+    return hashSequence<int>(ValueTag::INT_VECTOR, value);
+  if (type == typeid(std::vector<double>))
+    return hashSequence<double>(ValueTag::DOUBLE_VECTOR, value);
+  if (type == typeid(std::vector<bool>))
+    return hashSequence<bool>(ValueTag::BOOL_VECTOR, value);
+  if (type == typeid(std::vector<InternedString>))
+    return hashSequence<InternedString>(ValueTag::STRING_VECTOR, value);
+  if (type == typeid(std::vector<std::string>))
+    return hashSequence<std::string>(ValueTag::STRING_VECTOR, value);
+
+  Hasher hasher(static_cast<uint64_t>(ValueTag::OTHER));
+  hasher.add(std::string_view(type.name()));
+  return hasher.finish();
+}
+
+uint64_t ParameterFingerprints::nodeFingerprint(const Node& node) { return mix(node.children_sum ^ mix(node.parameter_count)); }
+
+uint64_t ParameterFingerprints::childHash(std::string_view token, uint64_t child_fingerprint)
+{
+  Hasher hasher(child_fingerprint);
+  hasher.add(token);
+  return hasher.finish();
+}
+
+}  // namespace paraminf
@@ -2,15 +2,207 @@
 
 namespace paraminf
 {
+namespace
+{
+// the global heap, which is not owned by the shared pointer
+std::shared_ptr<std::pmr::memory_resource> defaultMemoryResource() { return std::shared_ptr<std::pmr::memory_resource>(std::shared_ptr<void>(), std::pmr::new_delete_resource()); }
+}  // namespace
+
+// the staged parameters use the memory resource of the interface, s.t. their nodes can be spliced into the parameter set on commit
+ParameterInterface::Transaction::Transaction(ParameterInterface& parameter_interface)
+  : parameter_interface_(&parameter_interface), staged_parameters_(parameter_interface.memory_resource_.get())
+{
+}
+
+void ParameterInterface::Transaction::removeParam(const std::string& parameter_name)
+{
+  auto itr = staged_parameters_.find(parameter_name);
+  if (itr != staged_parameters_.end())
+    staged_parameters_.erase(itr);
+  staged_removals_.insert(parameter_name);
+}
+
+void ParameterInterface::Transaction::commit()
+{
+  if (empty())
+    return;
+
+  parameter_interface_->commitTransaction(*this);
+  discard();
+}
+
+void ParameterInterface::Transaction::discard()
+{
+  staged_parameters_.clear();
+  staged_removals_.clear();
+}
+
+bool ParameterInterface::Transaction::empty() const { return staged_parameters_.empty() && staged_removals_.empty(); }
+
+ParameterInterface::ParameterInterface() : ParameterInterface(std::make_shared<StringPool>()) {}
+
+ParameterInterface::ParameterInterface(StringPool::Ptr string_pool) : ParameterInterface(string_pool, defaultMemoryResource()) {}
+
+ParameterInterface::ParameterInterface(StringPool::Ptr string_pool, std::shared_ptr<std::pmr::memory_resource> memory_resource)
+  : string_pool_(string_pool), memory_resource_(memory_resource), parameter_set_(memory_resource_.get())
+{
+  if (!string_pool_)
+    throw std::invalid_argument("String pool of the parameter interface must not be null");
+  if (!memory_resource_)
+    throw std::invalid_argument("Memory resource of the parameter interface must not be null");
+}
+
+// the copy shares the memory resource like the pool, the resource is never changed and can be read without the lock
+ParameterInterface::ParameterInterface(const ParameterInterface& other) : memory_resource_(other.memory_resource_), parameter_set_(memory_resource_.get())
+{
+  std::shared_lock<std::shared_mutex> lock(other.mutex_);
+  has_been_updated_ = other.has_been_updated_;
+  // the copy shares the pool, s.t. the interned strings are shared instead of copied
+  string_pool_ = other.string_pool_;
+  parameter_set_ = other.parameter_set_;
+  if (other.fingerprints_)
+    fingerprints_ = std::make_unique<ParameterFingerprints>(*other.fingerprints_);
+}
+
+ParameterInterface& ParameterInterface::operator=(const ParameterInterface& other)
+{
+  if (this == &other)
+    return *this;
+
+  // all previous and all new parameters are reported as changed, the subscriptions are kept
+  // like the memory resource the pool is kept, as it is read without the lock, so the copied strings are interned again if necessary
+  ParameterSubscriptions::Batch changes;
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_, std::defer_lock);
+    std::shared_lock<std::shared_mutex> other_lock(other.mutex_, std::defer_lock);
+    std::lock(lock, other_lock);
+    collectChanges(parameter_set_, changes);
+    collectChanges(other.parameter_set_, changes);
+    has_been_updated_ = other.has_been_updated_;
+    if (other.string_pool_ == string_pool_)
+      parameter_set_ = other.parameter_set_;
+    else
+      parameter_set_ = internParameterSet(other.parameter_set_);
+    fingerprints_ = other.fingerprints_ ? std::make_unique<ParameterFingerprints>(*other.fingerprints_) : nullptr;
+    version_++;
+  }
+  deliverChanges(changes);
+  return *this;
+}
+
+bool ParameterInterface::removeParam(const std::string& parameter_name)
+{
+  ParameterSubscriptions::Batch changes;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto itr = parameter_set_.find(parameter_name);
+  if (itr == parameter_set_.end())
+    return false;
+  if (subscriptions_)
+    subscriptions_->collect(itr->first.view(), changes);
+  if (fingerprints_)
+    fingerprints_->update(itr->first.view(), &itr->second, nullptr);
+  parameter_set_.erase(itr);
+
+  has_been_updated_ = true;
+  version_++;
+  lock.unlock();
+  deliverChanges(changes);
+  return true;
+}
+
+ParameterInterface::Transaction ParameterInterface::beginTransaction() { return Transaction(*this); }
+
+void ParameterInterface::mergeParameters(const ParameterInterface& other)
+{
+  if (this == &other)
+    return;
+
+  ParameterSubscriptions::Batch changes;
+  std::unique_lock<std::shared_mutex> lock(mutex_, std::defer_lock);
+  std::shared_lock<std::shared_mutex> other_lock(other.mutex_, std::defer_lock);
+  std::lock(lock, other_lock);
+  if (other.parameter_set_.empty())
+    return;
+  collectChanges(other.parameter_set_, changes);
+
+  if (other.string_pool_ == string_pool_)
+  {
+    for (const auto& parameter : other.parameter_set_)
+    {
+      if (fingerprints_)
+        updateFingerprints(parameter.first, &parameter.second);
+      parameter_set_.insert_or_assign(parameter.first, parameter.second);
+    }
+  }
+  else
+  {
+    ParameterMap interned_parameters = internParameterSet(other.parameter_set_);
+    mergeParameterSet(interned_parameters);
+  }
+  has_been_updated_ = true;
+  version_++;
+  lock.unlock();
+  other_lock.unlock();
+  deliverChanges(changes);
+}
+
+void ParameterInterface::mergeParameters(ParameterInterface&& other)
+{
+  if (this == &other)
+    return;
+
+  // the parameters are reported as set to the subscribers of this interface and as removed to the ones of the other interface
+  ParameterSubscriptions::Batch changes;
+  ParameterSubscriptions::Batch other_changes;
+  std::unique_lock<std::shared_mutex> lock(mutex_, std::defer_lock);
+  std::unique_lock<std::shared_mutex> other_lock(other.mutex_, std::defer_lock);
+  std::lock(lock, other_lock);
+  if (other.parameter_set_.empty())
+    return;
+  collectChanges(other.parameter_set_, changes);
+  other.collectChanges(other.parameter_set_, other_changes);
+
+  if (other.string_pool_ == string_pool_)
+  {
+    mergeParameterSet(other.parameter_set_);
+  }
+  else
+  {
+    ParameterMap interned_parameters = internParameterSet(other.parameter_set_);
+    mergeParameterSet(interned_parameters);
+  }
+  other.parameter_set_.clear();
+  if (other.fingerprints_)
+    other.fingerprints_->clear();
+  other.version_++;
+  has_been_updated_ = true;
+  version_++;
+  lock.unlock();
+  other_lock.unlock();
+  // the subscribers of the other interface are notified even if a callback of this interface throws
+  try
+  {
+    deliverChanges(changes);
+  }
+  catch (...)
+  {
+    other.deliverChanges(other_changes);
+    throw;
+  }
+  other.deliverChanges(other_changes);
+}
+
 bool ParameterInterface::hasParam(const std::string& parameter_name) const
 {
-  std::map<std::string, std::any>::const_iterator itr = parameter_set_.find(parameter_name);
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  ParameterMap::const_iterator itr = parameter_set_.find(parameter_name);
 
   return itr != parameter_set_.end();
 }
 
 std::vector<std::string> ParameterInterface::getAllParameterNames() const
 {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   size_t parameter_number = parameter_set_.size();
 
   std::vector<std::string> parameter_names(parameter_number);
@@ -18,7 +210,7 @@ std::vector<std::string> ParameterInterface::getAllParameterNames() const
   size_t counter = 0;
   for (auto const& element : parameter_set_)
   {
-    parameter_names[counter] = element.first;
+    parameter_names[counter] = element.first.str();
     counter++;
   }
 
@@ -26,8 +218,252 @@ std::vector<std::string> ParameterInterface::getAllParameterNames() const
   return parameter_names;
 }
 
-bool ParameterInterface::hasBeenUpdated() const { return has_been_updated_; }
+std::map<std::string, ParameterInterface, std::less<>> ParameterInterface::getPartitions(size_t partition_depth,
+                                                                                       const std::set<std::string, std::less<>>* selected_partitions) const
+{
+  std::map<std::string, ParameterInterface, std::less<>> partitions;
+  auto add_parameter = [&](std::string_view partition_namespace, const ParameterMap::value_type& parameter) {
+    auto itr = partitions.find(partition_namespace);
+    if (itr == partitions.end())
+      itr = partitions.try_emplace(std::string(partition_namespace), string_pool_, memory_resource_).first;
+    itr->second.parameter_set_.emplace_hint(itr->second.parameter_set_.end(), parameter.first, parameter.second);
+  };
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  if (!selected_partitions)
+  {
+    for (const auto& parameter : parameter_set_)
+    {
+      add_parameter(getPartitionNamespace(parameter.first.view(), partition_depth), parameter);
+    }
+    return partitions;
+  }
+
+  // the names are ordered by their content, s.t. the names in a namespace "a" form the range ["a/", "a0"), as '0' follows '/'
+  for (const std::string& partition_namespace : *selected_partitions)
+  {
+    ParameterMap::const_iterator itr = parameter_set_.begin();
+    ParameterMap::const_iterator end = parameter_set_.end();
+    if (!partition_namespace.empty())
+    {
+      itr = parameter_set_.lower_bound(std::string_view(partition_namespace + '/'));
+      end = parameter_set_.lower_bound(std::string_view(partition_namespace + '0'));
+    }
+    while (itr != end)
+    {
+      std::string_view parameter_partition = getPartitionNamespace(itr->first.view(), partition_depth);
+      if (parameter_partition == partition_namespace)
+      {
+        add_parameter(partition_namespace, *itr);
+        ++itr;
+      }
+      else if (parameter_partition.size() > partition_namespace.size())
+      {
+        // the parameter belongs to a nested partition, whose names are skipped at once
+        itr = parameter_set_.lower_bound(std::string_view(std::string(parameter_partition) + '0'));
+      }
+      else
+      {
+        // the namespace is deeper than the partition depth, so all of its parameters belong to an enclosing partition
+        break;
+      }
+    }
+  }
+  return partitions;
+}
+
+std::string_view ParameterInterface::getPartitionNamespace(std::string_view parameter_name, size_t partition_depth)
+{
+  size_t namespace_end = parameter_name.rfind('/');
+  if (namespace_end == std::string_view::npos)
+    return std::string_view();
+
+  size_t partition_end = 0;
+  for (size_t depth = 0; depth < partition_depth && partition_end < namespace_end; depth++)
+  {
+    partition_end = parameter_name.find('/', partition_end + (depth > 0 ? 1 : 0));
+  }
+  return parameter_name.substr(0, partition_end);
+}
+
+bool ParameterInterface::hasBeenUpdated() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return has_been_updated_;
+}
+
+void ParameterInterface::resetUpdateFlag()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  has_been_updated_ = false;
+}
+
+uint64_t ParameterInterface::getVersion() const { return version_; }
+
+uint64_t ParameterInterface::getFingerprint(const std::string& name_space) const
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (fingerprints_)
+      return fingerprints_->getFingerprint(name_space);
+  }
+
+  // the fingerprints are built on the first query, another thread might have built them while waiting for the exclusive lock
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (!fingerprints_)
+  {
+    fingerprints_ = std::make_unique<ParameterFingerprints>();
+    for (const auto& parameter : parameter_set_)
+    {
+      fingerprints_->update(parameter.first.view(), nullptr, &parameter.second);
+    }
+  }
+  return fingerprints_->getFingerprint(name_space);
+}
+
+uint64_t ParameterInterface::subscribe(const std::string& name_space, ParameterSubscriptions::Callback callback, ParameterSubscriptions::Delivery delivery,
+                                       std::chrono::milliseconds coalescing_interval)
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!subscriptions_)
+      subscriptions_ = std::make_unique<ParameterSubscriptions>();
+  }
+  return subscriptions_->subscribe(name_space, std::move(callback), delivery, coalescing_interval);
+}
+
+bool ParameterInterface::unsubscribe(uint64_t subscription_id)
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (!subscriptions_)
+      return false;
+  }
+  return subscriptions_->unsubscribe(subscription_id);
+}
+
+StringPool::Ptr ParameterInterface::getStringPool() const { return string_pool_; }
+
+std::shared_ptr<std::pmr::memory_resource> ParameterInterface::getMemoryResource() const { return memory_resource_; }
+
+void ParameterInterface::commitTransaction(Transaction& transaction)
+{
+  ParameterSubscriptions::Batch changes;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  collectChanges(transaction.staged_parameters_, changes);
+
+  // removals of parameters that do not exist do not change anything, s.t. neither the update flag nor the version are touched
+  bool has_changes = !transaction.staged_parameters_.empty();
+  for (const auto& parameter_name : transaction.staged_removals_)
+  {
+    auto itr = parameter_set_.find(parameter_name);
+    if (itr == parameter_set_.end())
+      continue;
+    has_changes = true;
+    if (subscriptions_)
+      subscriptions_->collect(itr->first.view(), changes);
+    if (fingerprints_)
+      fingerprints_->update(itr->first.view(), &itr->second, nullptr);
+    parameter_set_.erase(itr);
+  }
+
+  if (!has_changes)
+    return;
+  mergeParameterSet(transaction.staged_parameters_);
 
-void ParameterInterface::resetUpdateFlag() { has_been_updated_ = false; }
+  has_been_updated_ = true;
+  version_++;
+  lock.unlock();
+  deliverChanges(changes);
+}
+
+void ParameterInterface::collectChanges(const ParameterMap& parameters, ParameterSubscriptions::Batch& changes) const
+{
+  if (!subscriptions_)
+    return;
+  for (const auto& parameter : parameters)
+  {
+    subscriptions_->collect(parameter.first.view(), changes);
+  }
+}
+
+void ParameterInterface::mergeParameterSet(ParameterMap& source)
+{
+  if (fingerprints_)
+  {
+    for (const auto& parameter : source)
+    {
+      updateFingerprints(parameter.first, &parameter.second);
+    }
+  }
+
+  // nodes can only be relinked between maps using the same memory resource, e.g. not when merging another interface
+  if (source.get_allocator() != parameter_set_.get_allocator())
+  {
+    for (auto& parameter : source)
+    {
+      parameter_set_.insert_or_assign(parameter.first, std::move(parameter.second));
+    }
+    source.clear();
+    return;
+  }
+
+  // splice all parameters with new names into the parameter set, this relinks the nodes instead of copying them
+  parameter_set_.merge(source);
+
+  // parameters that already existed are left in the source by merge() and overwrite the current values
+  for (auto& parameter : source)
+  {
+    parameter_set_.find(parameter.first)->second = std::move(parameter.second);
+  }
+}
+
+ParameterInterface::ParameterMap ParameterInterface::internParameterSet(const ParameterMap& source) const
+{
+  ParameterMap interned_parameters(memory_resource_.get());
+  for (const auto& parameter : source)
+  {
+    std::any value = parameter.second;
+    if (isType<InternedString>(value))
+      value = string_pool_->intern(std::any_cast<const InternedString&>(value).view());
+    else if (isType<std::vector<InternedString>>(value))
+    {
+      for (auto& element : std::any_cast<std::vector<InternedString>&>(value))
+      {
+        element = string_pool_->intern(element.view());
+      }
+    }
+    interned_parameters.emplace_hint(interned_parameters.end(), string_pool_->intern(parameter.first.view()), std::move(value));
+  }
+  return interned_parameters;
+}
+
+std::any ParameterInterface::internValue(std::any&& value) const
+{
+  if (isType<std::string>(value))
+    return string_pool_->intern(std::any_cast<const std::string&>(value));
+  if (isType<std::vector<std::string>>(value))
+    return internVector(std::any_cast<const std::vector<std::string>&>(value));
+  if (isType<InternedString>(value))
+    return string_pool_->intern(std::any_cast<const InternedString&>(value).view());
+  return std::move(value);
+}
+
+std::vector<InternedString> ParameterInterface::internVector(const std::vector<std::string>& values) const
+{
+  std::vector<InternedString> interned_values;
+  interned_values.reserve(values.size());
+  for (const auto& value : values)
+  {
+    interned_values.push_back(string_pool_->intern(value));
+  }
+  return interned_values;
+}
+
+void ParameterInterface::updateFingerprints(const InternedString& parameter_name, const std::any* new_value)
+{
+  ParameterMap::const_iterator itr = parameter_set_.find(parameter_name);
+  fingerprints_->update(parameter_name.view(), itr != parameter_set_.end() ? &itr->second : nullptr, new_value);
+}
 
 }  // namespace paraminf
@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "paraminf/json_io_handler.h"
+#include "paraminf/parameter_io_backend.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace
+{
+bool isWhitespace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r'; }
+
+// yaml-cpp accepts trailing whitespace after numbers but no leading whitespace
+std::string_view trimTrailingWhitespace(std::string_view text)
+{
+  while (!text.empty() && isWhitespace(text.back()))
+  {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+bool isDigitOfBase(char c, int base)
+{
+  if (base == 16)
+    return std::isxdigit(static_cast<unsigned char>(c));
+  return c >= '0' && c < '0' + base;
+}
+
+// yaml-cpp only accepts bools that are entirely lower case, entirely upper case or capitalized
+bool hasFlexibleCase(std::string_view text)
+{
+  auto is_lower = [](char c) { return !std::isupper(static_cast<unsigned char>(c)); };
+  auto is_upper = [](char c) { return !std::islower(static_cast<unsigned char>(c)); };
+  if (text.empty() || std::all_of(text.begin(), text.end(), is_lower))
+    return true;
+  return std::isupper(static_cast<unsigned char>(text[0])) &&
+         (std::all_of(text.begin() + 1, text.end(), is_lower) || std::all_of(text.begin() + 1, text.end(), is_upper));
+}
+
+bool equalsIgnoringCase(std::string_view text, std::string_view lower_case_word)
+{
+  return text.size() == lower_case_word.size() &&
+         std::equal(text.begin(), text.end(), lower_case_word.begin(), [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+}
+
+template <typename T>
+std::any convertSequenceTo(const std::vector<std::string_view>& elements, bool (*parse)(std::string_view, T&))
+{
+  std::vector<T> values(elements.size());
+  for (size_t i = 0; i < elements.size(); i++)
+  {
+    T value;
+    if (!parse(elements[i], value))
+      return std::any();
+    values[i] = value;
+  }
+  return values;
+}
+}  // namespace
+
+bool ParameterIOBackend::readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const
+{
+  std::ifstream input_file(file_path, std::ios::binary);
+  if (!input_file)
+    return false;
+  std::stringstream input;
+  input << input_file.rdbuf();
+  return readAndAddParametersFromString(input.str(), parameter_interface);
+}
+
+bool ParameterIOBackend::writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const
+{
+  std::string output;
+  if (!writeParametersToString(parameter_interface, output))
+    return false;
+  std::ofstream output_file(file_path, std::ios::binary);
+  output_file << output;
+  return static_cast<bool>(output_file);
+}
+
+ParameterIOBackend::Ptr ParameterIOBackend::createForFile(const std::string& file_path, Conversion conversion)
+{
+  const std::string json_extension = ".json";
+  if (file_path.size() >= json_extension.size() && file_path.compare(file_path.size() - json_extension.size(), json_extension.size(), json_extension) == 0)
+    return std::make_shared<JsonIOBackend>(conversion);
+  return std::make_shared<YamlIOBackend>(conversion);
+}
+
+std::any ParameterIOBackend::convertScalar(std::string_view text)
+{
+  int int_value;
+  if (parseInt(text, int_value))
+    return int_value;
+  double double_value;
+  if (parseDouble(text, double_value))
+    return double_value;
+  bool bool_value;
+  if (parseBool(text, bool_value))
+    return bool_value;
+  return std::string(text);
+}
+
+std::any ParameterIOBackend::convertSequence(const std::vector<std::string_view>& elements)
+{
+  std::any values = convertSequenceTo<int>(elements, &parseInt);
+  if (!values.has_value())
+    values = convertSequenceTo<double>(elements, &parseDouble);
+  if (!values.has_value())
+    values = convertSequenceTo<bool>(elements, &parseBool);
+  if (!values.has_value())
+    values = std::vector<std::string>(elements.begin(), elements.end());
+  return values;
+}
+
+void ParameterIOBackend::traverseParameterTree(const ParameterInterface& parameter_interface, TreeVisitor& visitor)
+{
+  traverseParameterTree(parameter_interface.getAllParameterNames(), visitor);
+}
+
+void ParameterIOBackend::traverseParameterTree(const std::vector<std::string>& parameter_names, TreeVisitor& visitor)
+{
+  std::vector<std::string> open_tokens;
+  std::vector<std::string> new_tokens;
+  for (const auto& parameter_name : parameter_names)
+  {
+    new_tokens.clear();
+    size_t token_begin = 0;
+    while (true)
+    {
+      size_t token_end = parameter_name.find('/', token_begin);
+      new_tokens.emplace_back(parameter_name, token_begin, token_end == std::string::npos ? std::string::npos : token_end - token_begin);
+      if (token_end == std::string::npos)
+        break;
+      token_begin = token_end + 1;
+    }
+
+    // count the number of tokens that are consecutively equal in the prefix path of the namespaces that are already open
+    // and the new parameter, the last token is the name of the parameter itself
+    size_t nr_of_same_tokens = 0;
+    while (nr_of_same_tokens < open_tokens.size() && nr_of_same_tokens < new_tokens.size() - 1 && new_tokens[nr_of_same_tokens] == open_tokens[nr_of_same_tokens])
+    {
+      nr_of_same_tokens++;
+    }
+
+    // close all namespaces that are not part of the new parameter path and open the missing ones
+    for (size_t i = nr_of_same_tokens; i < open_tokens.size(); i++)
+    {
+      visitor.endNamespace();
+    }
+    for (size_t i = nr_of_same_tokens; i < new_tokens.size() - 1; i++)
+    {
+      visitor.beginNamespace(new_tokens[i]);
+    }
+    visitor.visitParameter(new_tokens.back(), parameter_name);
+
+    new_tokens.pop_back();
+    std::swap(open_tokens, new_tokens);
+  }
+
+  // close all namespaces that are still open after the last parameter
+  for (size_t i = 0; i < open_tokens.size(); i++)
+  {
+    visitor.endNamespace();
+  }
+}
+
+bool ParameterIOBackend::parseInt(std::string_view text, int& value)
+{
+  text = trimTrailingWhitespace(text);
+
+  bool negative = false;
+  if (!text.empty() && (text[0] == '+' || text[0] == '-'))
+  {
+    negative = text[0] == '-';
+    text.remove_prefix(1);
+  }
+
+  // like std::istream without std::dec a leading "0x" selects hexadecimal and a leading "0" octal notation
+  int base = 10;
+  if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+  {
+    base = 16;
+    text.remove_prefix(2);
+  }
+  else if (!text.empty() && text[0] == '0')
+    base = 8;
+
+  if (text.empty())
+    return false;
+
+  int64_t magnitude = 0;
+  for (char c : text)
+  {
+    if (!isDigitOfBase(c, base))
+      return false;
+    int digit = std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(static_cast<unsigned char>(c)) - 'a' + 10;
+    magnitude = magnitude * base + digit;
+    if (magnitude > static_cast<int64_t>(std::numeric_limits<int>::max()) + 1)
+      return false;
+  }
+
+  int64_t signed_value = negative ? -magnitude : magnitude;
+  if (signed_value > std::numeric_limits<int>::max())
+    return false;
+  value = static_cast<int>(signed_value);
+  return true;
+}
+
+bool ParameterIOBackend::parseDouble(std::string_view text, double& value)
+{
+  if (text == ".inf" || text == ".Inf" || text == ".INF" || text == "+.inf" || text == "+.Inf" || text == "+.INF")
+  {
+    value = std::numeric_limits<double>::infinity();
+    return true;
+  }
+  if (text == "-.inf" || text == "-.Inf" || text == "-.INF")
+  {
+    value = -std::numeric_limits<double>::infinity();
+    return true;
+  }
+  if (text == ".nan" || text == ".NaN" || text == ".NAN")
+  {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+
+  std::string_view number = trimTrailingWhitespace(text);
+  // std::from_chars does not accept a leading '+', but does accept "inf" and "nan" which std::istream does not
+  size_t sign_length = !number.empty() && (number[0] == '+' || number[0] == '-') ? 1 : 0;
+  if (number.size() <= sign_length || !(std::isdigit(static_cast<unsigned char>(number[sign_length])) || number[sign_length] == '.'))
+    return false;
+  if (number[0] == '+')
+    number.remove_prefix(1);
+
+  double parsed_value;
+  auto result = std::from_chars(number.data(), number.data() + number.size(), parsed_value);
+  if (result.ec != std::errc() || result.ptr != number.data() + number.size())
+    return false;
+  value = parsed_value;
+  return true;
+}
+
+bool ParameterIOBackend::parseBool(std::string_view text, bool& value)
+{
+  static constexpr std::string_view true_names[] = { "y", "yes", "true", "on" };
+  static constexpr std::string_view false_names[] = { "n", "no", "false", "off" };
+
+  if (!hasFlexibleCase(text))
+    return false;
+  for (size_t i = 0; i < 4; i++)
+  {
+    if (equalsIgnoringCase(text, true_names[i]))
+    {
+      value = true;
+      return true;
+    }
+    if (equalsIgnoringCase(text, false_names[i]))
+    {
+      value = false;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace paraminf
@@ -0,0 +1,342 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "paraminf/parameter_io_backend.h"
+#include "paraminf/parameter_journal.h"
+#include "file_sync.h"
+
+namespace paraminf
+{
+namespace
+{
+// each record is framed by the size of its payload and the CRC32 of the payload
+constexpr size_t frame_header_size = 2 * sizeof(uint32_t);
+
+uint32_t crc32(const char* data, size_t size)
+{
+  static const std::array<uint32_t, 256> table = []() {
+    std::array<uint32_t, 256> values;
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t value = i;
+      for (int bit = 0; bit < 8; bit++)
+      {
+        value = value & 1 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+      }
+      values[i] = value;
+    }
+    return values;
+  }();
+
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; i++)
+  {
+    crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+bool fileExists(const std::string& file_path) { return access(file_path.c_str(), F_OK) == 0; }
+
+bool writeAll(int fd, const char* data, size_t size)
+{
+  while (size > 0)
+  {
+    ssize_t written = write(fd, data, size);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+void fulfill(std::vector<std::promise<bool>>& promises, bool value)
+{
+  for (auto& promise : promises)
+  {
+    promise.set_value(value);
+  }
+  promises.clear();
+}
+}  // namespace
+
+ParameterJournal::ParameterJournal(ParameterInterface::Ptr parameter_interface, const std::string& base_file_path, const std::string& journal_file_path,
+                                   std::chrono::milliseconds sync_interval, size_t compaction_threshold)
+  : parameter_interface_(parameter_interface)
+  , base_file_path_(base_file_path)
+  , journal_file_path_(journal_file_path)
+  , sync_interval_(sync_interval)
+  , compaction_threshold_(compaction_threshold)
+{
+  if (!parameter_interface_)
+  {
+    throw std::invalid_argument("Parameter interface of the journal must not be null");
+  }
+
+  if (fileExists(base_file_path_) && !ParameterIOBackend::createForFile(base_file_path_)->readAndAddParametersFromFile(base_file_path_, *parameter_interface_))
+  {
+    throw std::runtime_error("Base snapshot " + base_file_path_ + " can not be read");
+  }
+  written_size_ = replay(journal_file_path_, *parameter_interface_, replayed_record_count_);
+  journal_size_ = written_size_;
+
+  // the torn tail is cut off, s.t. new records directly follow the valid ones
+  journal_fd_ = open(journal_file_path_.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+  if (journal_fd_ < 0 || ftruncate(journal_fd_, written_size_) != 0 || lseek(journal_fd_, written_size_, SEEK_SET) < 0)
+  {
+    if (journal_fd_ >= 0)
+      close(journal_fd_);
+    throw std::runtime_error("Journal " + journal_file_path_ + " can not be opened");
+  }
+  worker_thread_ = std::thread(&ParameterJournal::run, this);
+}
+
+ParameterJournal::~ParameterJournal()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_one();
+  worker_thread_.join();
+  close(journal_fd_);
+}
+
+bool ParameterJournal::removeParam(const std::string& parameter_name)
+{
+  // the record is appended before the removal, s.t. records appended by callbacks of the removal follow it
+  std::lock_guard<std::recursive_mutex> update_lock(update_mutex_);
+  if (!parameter_interface_->hasParam(parameter_name))
+    return false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    appendRecord(RecordType::REMOVE, parameter_name, std::string());
+  }
+  return parameter_interface_->removeParam(parameter_name);
+}
+
+std::shared_future<bool> ParameterJournal::sync()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  sync_promises_.emplace_back();
+  condition_.notify_one();
+  return sync_promises_.back().get_future().share();
+}
+
+std::shared_future<bool> ParameterJournal::requestCompaction()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  compaction_promises_.emplace_back();
+  condition_.notify_one();
+  return compaction_promises_.back().get_future().share();
+}
+
+size_t ParameterJournal::getReplayedRecordCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return replayed_record_count_;
+}
+
+size_t ParameterJournal::getJournalSize() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return journal_size_;
+}
+
+size_t ParameterJournal::getCompactionCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compaction_count_;
+}
+
+size_t ParameterJournal::replay(const std::string& journal_file_path, ParameterInterface& parameter_interface, size_t& record_count)
+{
+  record_count = 0;
+  std::ifstream journal_file(journal_file_path, std::ios::binary);
+  if (!journal_file)
+    return 0;
+  std::stringstream journal_stream;
+  journal_stream << journal_file.rdbuf();
+  const std::string journal = journal_stream.str();
+
+  // the records are applied at once, s.t. readers never see a partially replayed journal
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  size_t offset = 0;
+  while (true)
+  {
+    size_t record_begin = offset;
+    uint32_t payload_size;
+    uint32_t checksum;
+    if (!ParameterCodec::decodeNumber(journal.data(), journal.size(), offset, payload_size) ||
+        !ParameterCodec::decodeNumber(journal.data(), journal.size(), offset, checksum) || journal.size() - offset < payload_size ||
+        crc32(journal.data() + offset, payload_size) != checksum)
+    {
+      offset = record_begin;
+      break;
+    }
+
+    size_t payload_end = offset + payload_size;
+    uint8_t record_type;
+    std::string parameter_name;
+    std::any value;
+    bool valid = ParameterCodec::decodeNumber(journal.data(), payload_end, offset, record_type) &&
+                 ParameterCodec::decodeString(journal.data(), payload_end, offset, parameter_name);
+    if (valid && static_cast<RecordType>(record_type) == RecordType::SET && ParameterCodec::decodeValue(journal.data(), payload_end, offset, value) &&
+        offset == payload_end)
+      transaction.setParam(parameter_name, std::move(value));
+    else if (valid && static_cast<RecordType>(record_type) == RecordType::REMOVE && offset == payload_end)
+      transaction.removeParam(parameter_name);
+    else
+    {
+      offset = record_begin;
+      break;
+    }
+    record_count++;
+  }
+  transaction.commit();
+  return offset;
+}
+
+void ParameterJournal::appendRecord(RecordType record_type, const std::string& parameter_name, const std::string& encoded_value)
+{
+  size_t record_begin = pending_records_.size();
+  pending_records_.append(frame_header_size, '\0');
+  ParameterCodec::encodeNumber(static_cast<uint8_t>(record_type), pending_records_);
+  ParameterCodec::encodeString(parameter_name, pending_records_);
+  pending_records_ += encoded_value;
+
+  char* frame = &pending_records_[record_begin];
+  uint32_t payload_size = static_cast<uint32_t>(pending_records_.size() - record_begin - frame_header_size);
+  uint32_t checksum = crc32(frame + frame_header_size, payload_size);
+  std::memcpy(frame, &payload_size, sizeof(uint32_t));
+  std::memcpy(frame + sizeof(uint32_t), &checksum, sizeof(uint32_t));
+
+  journal_size_ += pending_records_.size() - record_begin;
+  // the first record of a batch starts the sync interval
+  if (record_begin == 0)
+    condition_.notify_one();
+}
+
+void ParameterJournal::run()
+{
+  size_t next_compaction_size = compaction_threshold_;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    condition_.wait(lock, [this] { return stop_ || !pending_records_.empty() || !sync_promises_.empty() || !compaction_promises_.empty(); });
+    if (stop_ && pending_records_.empty() && sync_promises_.empty() && compaction_promises_.empty())
+      return;
+
+    // records are collected for the sync interval unless a sync or compaction is requested explicitly
+    condition_.wait_for(lock, sync_interval_, [this] { return stop_ || !sync_promises_.empty() || !compaction_promises_.empty(); });
+
+    if (!compaction_promises_.empty() || (compaction_threshold_ > 0 && journal_size_ >= next_compaction_size))
+    {
+      std::vector<std::promise<bool>> promises = std::move(compaction_promises_);
+      compaction_promises_.clear();
+      lock.unlock();
+      bool success = compact();
+      fulfill(promises, success);
+      lock.lock();
+      // a failed compaction is not retried before the journal has grown by the threshold again
+      next_compaction_size = success ? compaction_threshold_ : journal_size_ + compaction_threshold_;
+      continue;
+    }
+
+    std::string records;
+    records.swap(pending_records_);
+    std::vector<std::promise<bool>> promises = std::move(sync_promises_);
+    sync_promises_.clear();
+    lock.unlock();
+    bool success = writeAndSync(records);
+    fulfill(promises, success);
+    lock.lock();
+    if (success)
+      written_size_ += records.size();
+  }
+}
+
+bool ParameterJournal::writeAndSync(const std::string& data)
+{
+  if (data.empty())
+    return true;
+  return writeAll(journal_fd_, data.data(), data.size()) && fdatasync(journal_fd_) == 0;
+}
+
+bool ParameterJournal::compact()
+{
+  // the snapshot contains exactly the updates of the records appended so far, which are persisted before replacing the base
+  std::unique_lock<std::recursive_mutex> update_lock(update_mutex_);
+  ParameterInterface snapshot(*parameter_interface_);
+  std::unique_lock<std::mutex> lock(mutex_);
+  std::string records;
+  records.swap(pending_records_);
+  std::vector<std::promise<bool>> promises = std::move(sync_promises_);
+  sync_promises_.clear();
+  lock.unlock();
+  update_lock.unlock();
+
+  bool success = writeAndSync(records);
+  fulfill(promises, success);
+  if (!success)
+    return false;
+  lock.lock();
+  written_size_ += records.size();
+  lock.unlock();
+
+  std::string temporary_base_file_path = base_file_path_ + ".tmp";
+  if (!ParameterIOBackend::createForFile(base_file_path_)->writeParametersToFile(temporary_base_file_path, snapshot) ||
+      !renameDurably(temporary_base_file_path, base_file_path_))
+    return false;
+
+  // replaying the old journal on top of the new base results in the same parameters, so a crash before replacing it is harmless
+  lock.lock();
+  records.clear();
+  records.swap(pending_records_);
+  promises = std::move(sync_promises_);
+  sync_promises_.clear();
+  lock.unlock();
+
+  std::string temporary_journal_file_path = journal_file_path_ + ".tmp";
+  int new_journal_fd = open(temporary_journal_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  success = new_journal_fd >= 0 && writeAll(new_journal_fd, records.data(), records.size()) && fdatasync(new_journal_fd) == 0 &&
+            std::rename(temporary_journal_file_path.c_str(), journal_file_path_.c_str()) == 0;
+  if (!success)
+  {
+    if (new_journal_fd >= 0)
+      close(new_journal_fd);
+    // the records are still appended to the old journal, which remains valid on top of the new base
+    success = writeAndSync(records);
+    fulfill(promises, success);
+    lock.lock();
+    if (success)
+      written_size_ += records.size();
+    return false;
+  }
+  // the old journal has been unlinked by the rename, so the new one is used even if the rename might not be durable yet
+  success = syncParentDirectory(journal_file_path_);
+  fulfill(promises, success);
+
+  close(journal_fd_);
+  journal_fd_ = new_journal_fd;
+  lock.lock();
+  written_size_ = records.size();
+  journal_size_ = written_size_ + pending_records_.size();
+  if (success)
+    compaction_count_++;
+  return success;
+}
+
+}  // namespace paraminf
@@ -0,0 +1,103 @@
+#include "paraminf/parameter_codec.h"
+#include "paraminf/parameter_protocol.h"
+
+namespace paraminf
+{
+void ParameterProtocol::appendFrame(Opcode opcode, uint32_t request_id, const std::string& payload, std::string& buffer)
+{
+  ParameterCodec::encodeNumber(static_cast<uint32_t>(payload.size()), buffer);
+  ParameterCodec::encodeNumber(static_cast<uint8_t>(opcode), buffer);
+  ParameterCodec::encodeNumber(request_id, buffer);
+  buffer.append(payload);
+}
+
+bool ParameterProtocol::extractFrame(const std::string& buffer, size_t& offset, Frame& frame, bool& error)
+{
+  error = false;
+  if (buffer.size() - offset < HEADER_SIZE)
+    return false;
+
+  size_t header_offset = offset;
+  uint32_t payload_size = 0;
+  uint8_t opcode = 0;
+  if (!ParameterCodec::decodeNumber(buffer.data(), buffer.size(), header_offset, payload_size) ||
+      !ParameterCodec::decodeNumber(buffer.data(), buffer.size(), header_offset, opcode) ||
+      !ParameterCodec::decodeNumber(buffer.data(), buffer.size(), header_offset, frame.request_id))
+    return false;
+
+  if (payload_size > MAX_PAYLOAD_SIZE || opcode < static_cast<uint8_t>(Opcode::GET) || opcode > static_cast<uint8_t>(Opcode::NOTIFY))
+  {
+    error = true;
+    return false;
+  }
+  if (buffer.size() - header_offset < payload_size)
+    return false;
+
+  frame.opcode = static_cast<Opcode>(opcode);
+  frame.payload.assign(buffer, header_offset, payload_size);
+  offset = header_offset + payload_size;
+  return true;
+}
+
+std::string ParameterProtocol::encodeNames(const std::vector<std::string>& parameter_names)
+{
+  std::string payload;
+  ParameterCodec::encodeNumber(static_cast<uint32_t>(parameter_names.size()), payload);
+  for (const auto& parameter_name : parameter_names)
+  {
+    ParameterCodec::encodeString(parameter_name, payload);
+  }
+  return payload;
+}
+
+bool ParameterProtocol::decodeNames(const std::string& payload, size_t& offset, std::vector<std::string>& parameter_names)
+{
+  uint32_t name_count;
+  if (!ParameterCodec::decodeNumber(payload.data(), payload.size(), offset, name_count))
+    return false;
+
+  parameter_names.clear();
+  for (uint32_t i = 0; i < name_count; i++)
+  {
+    std::string parameter_name;
+    if (!ParameterCodec::decodeString(payload.data(), payload.size(), offset, parameter_name))
+      return false;
+    parameter_names.push_back(std::move(parameter_name));
+  }
+  return true;
+}
+
+bool ParameterProtocol::encodeParameters(const ParameterInterface& parameters, std::string& payload)
+{
+  std::vector<std::string> parameter_names = parameters.getAllParameterNames();
+  ParameterCodec::encodeNumber(static_cast<uint32_t>(parameter_names.size()), payload);
+  for (const auto& parameter_name : parameter_names)
+  {
+    ParameterCodec::encodeString(parameter_name, payload);
+    if (!ParameterCodec::encodeParameter(parameters, parameter_name, payload))
+      return false;
+  }
+  return true;
+}
+
+bool ParameterProtocol::decodeParameters(const std::string& payload, size_t& offset, ParameterInterface& parameters)
+{
+  uint32_t parameter_count;
+  if (!ParameterCodec::decodeNumber(payload.data(), payload.size(), offset, parameter_count))
+    return false;
+
+  ParameterInterface::Transaction transaction = parameters.beginTransaction();
+  for (uint32_t i = 0; i < parameter_count; i++)
+  {
+    std::string parameter_name;
+    std::any value;
+    if (!ParameterCodec::decodeString(payload.data(), payload.size(), offset, parameter_name) ||
+        !ParameterCodec::decodeValue(payload.data(), payload.size(), offset, value))
+      return false;
+    transaction.setParam(parameter_name, value);
+  }
+  transaction.commit();
+  return true;
+}
+
+}  // namespace paraminf
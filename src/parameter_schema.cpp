@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+
+#include "paraminf/parameter_schema.h"
+
+namespace paraminf
+{
+namespace
+{
+template <typename T>
+bool validateRange(const std::string& parameter_name, const ParameterSchema::Entry& entry, T value, std::string& error)
+{
+  // NaN compares false to any bound and would pass the range check otherwise
+  bool is_nan = false;
+  if constexpr (std::is_floating_point_v<T>)
+    is_nan = std::isnan(value);
+  if ((entry.min && (is_nan || value < *entry.min)) || (entry.max && (is_nan || value > *entry.max)))
+  {
+    error = "Parameter \"" + parameter_name + "\" with value " + std::to_string(value) + " is out of range";
+    return false;
+  }
+  return true;
+}
+
+bool validateEnum(const std::string& parameter_name, const ParameterSchema::Entry& entry, const std::string& value, std::string& error)
+{
+  if (!entry.enum_values.empty() && std::find(entry.enum_values.begin(), entry.enum_values.end(), value) == entry.enum_values.end())
+  {
+    error = "Parameter \"" + parameter_name + "\" with value \"" + value + "\" is not one of the allowed values";
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool validateVector(const std::string& parameter_name, const ParameterSchema::Entry& entry, const std::any& value, std::string& error)
+{
+  for (const auto& element : std::any_cast<const std::vector<T>&>(value))
+  {
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+      if (!validateEnum(parameter_name, entry, element, error))
+        return false;
+    }
+    else if constexpr (!std::is_same_v<T, bool>)
+    {
+      if (!validateRange(parameter_name, entry, element, error))
+        return false;
+    }
+  }
+  return true;
+}
+
+const std::vector<std::pair<ParameterSchema::Type, std::string>> TYPE_NAMES = {
+  { ParameterSchema::Type::INT, "int" },
+  { ParameterSchema::Type::DOUBLE, "double" },
+  { ParameterSchema::Type::BOOL, "bool" },
+  { ParameterSchema::Type::STRING, "string" },
+  { ParameterSchema::Type::INT_VECTOR, "int_vector" },
+  { ParameterSchema::Type::DOUBLE_VECTOR, "double_vector" },
+  { ParameterSchema::Type::BOOL_VECTOR, "bool_vector" },
+  { ParameterSchema::Type::STRING_VECTOR, "string_vector" },
+};
+
+const std::type_info& typeInfo(ParameterSchema::Type type)
+{
+  switch (type)
+  {
+    case ParameterSchema::Type::INT:
+      return typeid(int);
+    case ParameterSchema::Type::DOUBLE:
+      return typeid(double);
+    case ParameterSchema::Type::BOOL:
+      return typeid(bool);
+    case ParameterSchema::Type::STRING:
+      return typeid(std::string);
+    case ParameterSchema::Type::INT_VECTOR:
+      return typeid(std::vector<int>);
+    case ParameterSchema::Type::DOUBLE_VECTOR:
+      return typeid(std::vector<double>);
+    case ParameterSchema::Type::BOOL_VECTOR:
+      return typeid(std::vector<bool>);
+    default:
+      return typeid(std::vector<std::string>);
+  }
+}
+}  // namespace
+
+bool ParameterSchema::addEntry(const std::string& parameter_name, const Entry& entry, std::string& error)
+{
+  bool is_numeric = entry.type == Type::INT || entry.type == Type::DOUBLE || entry.type == Type::INT_VECTOR || entry.type == Type::DOUBLE_VECTOR;
+  if ((entry.min || entry.max) && !is_numeric)
+  {
+    error = "Range of parameter \"" + parameter_name + "\" is only supported for int and double types";
+    return false;
+  }
+  if (!entry.enum_values.empty() && entry.type != Type::STRING && entry.type != Type::STRING_VECTOR)
+  {
+    error = "Allowed values of parameter \"" + parameter_name + "\" are only supported for string types";
+    return false;
+  }
+  if (entry.min && entry.max && *entry.min > *entry.max)
+  {
+    error = "Range of parameter \"" + parameter_name + "\" is empty";
+    return false;
+  }
+  if (entry.default_value.has_value() && !validate(parameter_name, entry, entry.default_value, error))
+  {
+    error = "Invalid default value: " + error;
+    return false;
+  }
+
+  entries_[parameter_name] = entry;
+  return true;
+}
+
+const ParameterSchema::Entry* ParameterSchema::findEntry(const std::string& parameter_name) const
+{
+  auto itr = entries_.find(parameter_name);
+  if (itr == entries_.end())
+    return nullptr;
+  return &itr->second;
+}
+
+std::vector<std::string> ParameterSchema::getAllParameterNames() const
+{
+  std::vector<std::string> parameter_names;
+  parameter_names.reserve(entries_.size());
+  for (const auto& entry : entries_)
+  {
+    parameter_names.push_back(entry.first);
+  }
+  std::sort(parameter_names.begin(), parameter_names.end());
+  return parameter_names;
+}
+
+bool ParameterSchema::validate(const std::string& parameter_name, const Entry& entry, const std::any& value, std::string& error)
+{
+  if (value.type() != typeInfo(entry.type))
+  {
+    error = "Parameter \"" + parameter_name + "\" is not of type " + typeToString(entry.type);
+    return false;
+  }
+
+  switch (entry.type)
+  {
+    case Type::INT:
+      return validateRange(parameter_name, entry, std::any_cast<int>(value), error);
+    case Type::DOUBLE:
+      return validateRange(parameter_name, entry, std::any_cast<double>(value), error);
+    case Type::STRING:
+      return validateEnum(parameter_name, entry, std::any_cast<const std::string&>(value), error);
+    case Type::INT_VECTOR:
+      return validateVector<int>(parameter_name, entry, value, error);
+    case Type::DOUBLE_VECTOR:
+      return validateVector<double>(parameter_name, entry, value, error);
+    case Type::STRING_VECTOR:
+      return validateVector<std::string>(parameter_name, entry, value, error);
+    default:
+      return true;
+  }
+}
+
+bool ParameterSchema::typeFromString(const std::string& type_name, Type& type)
+{
+  for (const auto& type_and_name : TYPE_NAMES)
+  {
+    if (type_and_name.second == type_name)
+    {
+      type = type_and_name.first;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string ParameterSchema::typeToString(Type type)
+{
+  for (const auto& type_and_name : TYPE_NAMES)
+  {
+    if (type_and_name.first == type)
+      return type_and_name.second;
+  }
+  return "unknown";
+}
+
+}  // namespace paraminf
@@ -0,0 +1,398 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "paraminf/parameter_codec.h"
+#include "paraminf/parameter_server.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace
+{
+constexpr uint8_t STATUS_OK = 1;
+constexpr uint8_t STATUS_ERROR = 0;
+
+// requests are not read while the pending output of the connection exceeds this size, s.t. clients that do not read their responses
+// can not make the server buffer them without bound
+constexpr size_t MAX_PENDING_OUTPUT_SIZE = 4 * 1024 * 1024;
+// notifications are pushed regardless of the requests, so subscribers that fall behind by this size are disconnected
+constexpr size_t MAX_BUFFERED_OUTPUT_SIZE = 64 * 1024 * 1024;
+
+std::string statusPayload(bool success) { return std::string(1, static_cast<char>(success ? STATUS_OK : STATUS_ERROR)); }
+}  // namespace
+
+ParameterServer::ParameterServer(const std::string& socket_path, ParameterInterface::Ptr parameter_interface)
+  : socket_path_(socket_path), parameter_interface_(parameter_interface)
+{
+  if (!parameter_interface_)
+    throw std::invalid_argument("Parameter interface of the server must not be null");
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path_.size() >= sizeof(address.sun_path))
+    throw std::invalid_argument("Socket path \"" + socket_path_ + "\" is too long");
+  std::strncpy(address.sun_path, socket_path_.c_str(), sizeof(address.sun_path) - 1);
+
+  listen_file_descriptor_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listen_file_descriptor_ < 0)
+    throw std::runtime_error(std::string("Failed to create socket: ") + std::strerror(errno));
+
+  unlink(socket_path_.c_str());
+  if (bind(listen_file_descriptor_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listen_file_descriptor_, SOMAXCONN) != 0 ||
+      pipe2(wake_pipe_, O_NONBLOCK | O_CLOEXEC) != 0)
+  {
+    std::runtime_error error("Failed to listen on socket \"" + socket_path_ + "\": " + std::strerror(errno));
+    close(listen_file_descriptor_);
+    throw error;
+  }
+
+  loader_thread_ = std::thread(&ParameterServer::runLoader, this);
+  server_thread_ = std::thread(&ParameterServer::run, this);
+}
+
+ParameterServer::~ParameterServer()
+{
+  {
+    std::lock_guard<std::mutex> lock(loader_mutex_);
+    stop_ = true;
+  }
+  loader_condition_.notify_one();
+  wakeUp();
+  server_thread_.join();
+  loader_thread_.join();
+
+  for (const auto& connection : connections_)
+  {
+    close(connection.first);
+  }
+  close(listen_file_descriptor_);
+  close(wake_pipe_[0]);
+  close(wake_pipe_[1]);
+  unlink(socket_path_.c_str());
+}
+
+ParameterInterface::Ptr ParameterServer::getParameterInterface() const { return parameter_interface_; }
+
+void ParameterServer::wakeUp()
+{
+  // writing can only fail if the pipe is full, i.e. a wake up is already pending
+  char wake = 0;
+  [[maybe_unused]] ssize_t written = write(wake_pipe_[1], &wake, 1);
+}
+
+void ParameterServer::run()
+{
+  std::vector<pollfd> poll_file_descriptors;
+  while (true)
+  {
+    poll_file_descriptors.clear();
+    poll_file_descriptors.push_back({ wake_pipe_[0], POLLIN, 0 });
+    poll_file_descriptors.push_back({ listen_file_descriptor_, POLLIN, 0 });
+    for (const auto& connection : connections_)
+    {
+      short events = 0;
+      if (!connection.second.input_closed && !connection.second.loading && connection.second.output.size() < MAX_PENDING_OUTPUT_SIZE)
+        events |= POLLIN;
+      if (!connection.second.output.empty())
+        events |= POLLOUT;
+      poll_file_descriptors.push_back({ connection.first, events, 0 });
+    }
+
+    if (poll(poll_file_descriptors.data(), poll_file_descriptors.size(), -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+
+    if (poll_file_descriptors[0].revents != 0)
+    {
+      char wake[64];
+      while (read(wake_pipe_[0], wake, sizeof(wake)) > 0)
+      {
+      }
+      std::vector<LoadResult> load_results;
+      {
+        std::lock_guard<std::mutex> lock(loader_mutex_);
+        if (stop_)
+          return;
+        load_results.swap(load_results_);
+      }
+      finishLoads(load_results);
+    }
+    if (poll_file_descriptors[1].revents & POLLIN)
+      acceptConnections();
+
+    for (size_t i = 2; i < poll_file_descriptors.size(); i++)
+    {
+      const pollfd& poll_file_descriptor = poll_file_descriptors[i];
+      if (poll_file_descriptor.revents == 0)
+        continue;
+
+      Connection& connection = connections_[poll_file_descriptor.fd];
+      bool keep_open = true;
+      if (!connection.input_closed && (poll_file_descriptor.revents & (POLLIN | POLLHUP | POLLERR)))
+        keep_open = readFromConnection(poll_file_descriptor.fd, connection);
+      else if (poll_file_descriptor.revents & (POLLHUP | POLLERR))
+        keep_open = false;
+      if (keep_open && (poll_file_descriptor.revents & POLLOUT))
+        keep_open = writeToConnection(poll_file_descriptor.fd, connection);
+
+      if (!keep_open)
+      {
+        close(poll_file_descriptor.fd);
+        connections_.erase(poll_file_descriptor.fd);
+      }
+    }
+
+    // flush the responses and notifications right away instead of waiting for the next poll, connections closed by the client are
+    // closed once all responses have been sent
+    for (auto itr = connections_.begin(); itr != connections_.end();)
+    {
+      if ((!itr->second.output.empty() && !writeToConnection(itr->first, itr->second)) || itr->second.output.size() > MAX_BUFFERED_OUTPUT_SIZE ||
+          (itr->second.input_closed && !itr->second.loading && itr->second.output.empty()))
+      {
+        close(itr->first);
+        itr = connections_.erase(itr);
+      }
+      else
+        itr++;
+    }
+  }
+}
+
+void ParameterServer::acceptConnections()
+{
+  while (true)
+  {
+    int file_descriptor = accept4(listen_file_descriptor_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (file_descriptor < 0)
+      return;
+    connections_[file_descriptor].id = next_connection_id_++;
+  }
+}
+
+bool ParameterServer::readFromConnection(int file_descriptor, Connection& connection)
+{
+  char buffer[65536];
+  while (connection.output.size() < MAX_PENDING_OUTPUT_SIZE)
+  {
+    ssize_t received = recv(file_descriptor, buffer, sizeof(buffer), 0);
+    if (received < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    // the requests received before the client closed the connection are still answered
+    connection.input.append(buffer, received);
+    if (!processRequests(connection))
+      return false;
+    if (received == 0)
+    {
+      connection.input_closed = true;
+      return true;
+    }
+  }
+  return true;
+}
+
+bool ParameterServer::processRequests(Connection& connection)
+{
+  // the requests following a file load are processed once it has been applied, s.t. they observe the loaded parameters
+  size_t offset = 0;
+  ParameterProtocol::Frame request;
+  bool error = false;
+  while (!connection.loading && ParameterProtocol::extractFrame(connection.input, offset, request, error))
+  {
+    processRequest(connection, request);
+  }
+  connection.input.erase(0, offset);
+  return !error;
+}
+
+bool ParameterServer::writeToConnection(int file_descriptor, Connection& connection)
+{
+  size_t written = 0;
+  while (written < connection.output.size())
+  {
+    ssize_t sent = send(file_descriptor, connection.output.data() + written, connection.output.size() - written, MSG_NOSIGNAL);
+    if (sent > 0)
+    {
+      written += sent;
+      continue;
+    }
+    if (sent < 0 && errno == EINTR)
+      continue;
+    if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      break;
+    return false;
+  }
+  connection.output.erase(0, written);
+  return true;
+}
+
+void ParameterServer::processRequest(Connection& connection, const ParameterProtocol::Frame& request)
+{
+  std::string response;
+  size_t offset = 0;
+  switch (request.opcode)
+  {
+    case ParameterProtocol::Opcode::GET:
+    {
+      std::vector<std::string> parameter_names;
+      if (!ParameterProtocol::decodeNames(request.payload, offset, parameter_names))
+      {
+        response = statusPayload(false);
+        break;
+      }
+      response = statusPayload(true);
+      ParameterCodec::encodeNumber(static_cast<uint32_t>(parameter_names.size()), response);
+      for (const auto& parameter_name : parameter_names)
+      {
+        size_t found_flag_position = response.size();
+        ParameterCodec::encodeNumber(static_cast<uint8_t>(1), response);
+        if (!ParameterCodec::encodeParameter(*parameter_interface_, parameter_name, response))
+          response[found_flag_position] = 0;
+      }
+      break;
+    }
+    case ParameterProtocol::Opcode::SET:
+    {
+      ParameterInterface updates;
+      bool success = ParameterProtocol::decodeParameters(request.payload, offset, updates);
+      if (success)
+        applyUpdates(updates);
+      response = statusPayload(success);
+      break;
+    }
+    case ParameterProtocol::Opcode::LOAD_FILE:
+    {
+      // the file is parsed by the loader thread, which answers the request once the parameters have been applied
+      connection.loading = true;
+      {
+        std::lock_guard<std::mutex> lock(loader_mutex_);
+        load_requests_.push_back({ connection.id, request.request_id, request.payload });
+      }
+      loader_condition_.notify_one();
+      return;
+    }
+    case ParameterProtocol::Opcode::SUBSCRIBE:
+      connection.subscribed_prefixes.push_back(request.payload);
+      response = statusPayload(true);
+      break;
+    default:
+      response = statusPayload(false);
+      break;
+  }
+  ParameterProtocol::appendFrame(request.opcode, request.request_id, response, connection.output);
+}
+
+void ParameterServer::runLoader()
+{
+  std::unique_lock<std::mutex> lock(loader_mutex_);
+  while (true)
+  {
+    loader_condition_.wait(lock, [this] { return stop_ || !load_requests_.empty(); });
+    if (stop_)
+      return;
+    LoadRequest load_request = std::move(load_requests_.front());
+    load_requests_.pop_front();
+    lock.unlock();
+
+    LoadResult load_result{ load_request.connection_id, load_request.request_id, std::make_unique<ParameterInterface>(), false };
+    load_result.success = YamlIOHandler::readAndAddParametersFromFile(load_request.file_path, *load_result.updates);
+
+    lock.lock();
+    load_results_.push_back(std::move(load_result));
+    wakeUp();
+  }
+}
+
+void ParameterServer::finishLoads(std::vector<LoadResult>& load_results)
+{
+  for (auto& load_result : load_results)
+  {
+    // the connection might have been closed while its file has been parsed
+    auto itr = std::find_if(connections_.begin(), connections_.end(),
+                            [&load_result](const std::pair<const int, Connection>& connection) { return connection.second.id == load_result.connection_id; });
+    if (itr == connections_.end())
+      continue;
+
+    if (load_result.success)
+      applyUpdates(*load_result.updates);
+    ParameterProtocol::appendFrame(ParameterProtocol::Opcode::LOAD_FILE, load_result.request_id, statusPayload(load_result.success), itr->second.output);
+    itr->second.loading = false;
+    if (!processRequests(itr->second))
+    {
+      close(itr->first);
+      connections_.erase(itr);
+    }
+  }
+}
+
+void ParameterServer::applyUpdates(const ParameterInterface& updates)
+{
+  std::vector<std::pair<std::string, std::string>> changed_parameters;
+
+  ParameterInterface::Transaction transaction = parameter_interface_->beginTransaction();
+  for (const auto& parameter_name : updates.getAllParameterNames())
+  {
+    std::string new_value;
+    std::string old_value;
+    if (!ParameterCodec::encodeParameter(updates, parameter_name, new_value))
+      continue;
+    if (ParameterCodec::encodeParameter(*parameter_interface_, parameter_name, old_value) && old_value == new_value)
+      continue;
+
+    std::any value;
+    size_t offset = 0;
+    ParameterCodec::decodeValue(new_value.data(), new_value.size(), offset, value);
+    transaction.setParam(parameter_name, value);
+    changed_parameters.emplace_back(parameter_name, std::move(new_value));
+  }
+  transaction.commit();
+
+  if (changed_parameters.empty())
+    return;
+
+  for (auto& connection : connections_)
+  {
+    if (connection.second.subscribed_prefixes.empty())
+      continue;
+
+    std::string payload;
+    uint32_t notified_count = 0;
+    ParameterCodec::encodeNumber(notified_count, payload);
+    for (const auto& changed_parameter : changed_parameters)
+    {
+      for (const auto& prefix : connection.second.subscribed_prefixes)
+      {
+        if (changed_parameter.first.compare(0, prefix.size(), prefix) == 0)
+        {
+          ParameterCodec::encodeString(changed_parameter.first, payload);
+          payload.append(changed_parameter.second);
+          notified_count++;
+          break;
+        }
+      }
+    }
+
+    if (notified_count > 0)
+    {
+      std::memcpy(payload.data(), &notified_count, sizeof(notified_count));
+      ParameterProtocol::appendFrame(ParameterProtocol::Opcode::NOTIFY, 0, payload, connection.second.output);
+    }
+  }
+}
+
+}  // namespace paraminf
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "paraminf/parameter_subscriptions.h"
+
+namespace paraminf
+{
+namespace
+{
+std::string_view normalizeNamespace(std::string_view name_space)
+{
+  if (!name_space.empty() && name_space.back() == '/')
+    name_space.remove_suffix(1);
+  return name_space;
+}
+}  // namespace
+
+ParameterSubscriptions::~ParameterSubscriptions()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_one();
+  if (dispatcher_thread_.joinable())
+    dispatcher_thread_.join();
+}
+
+uint64_t ParameterSubscriptions::subscribe(const std::string& name_space, Callback callback, Delivery delivery, std::chrono::milliseconds coalescing_interval)
+{
+  if (!callback)
+    throw std::invalid_argument("Callback of the subscription must not be empty");
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string_view normalized_name_space = normalizeNamespace(name_space);
+  auto node_itr = nodes_.find(normalized_name_space);
+  if (node_itr == nodes_.end())
+  {
+    auto node = std::make_unique<Node>();
+    node->name_space = normalized_name_space;
+    node_itr = nodes_.emplace(node->name_space, std::move(node)).first;
+  }
+
+  auto subscription = std::make_shared<Subscription>();
+  subscription->id = next_id_++;
+  subscription->node = node_itr->second.get();
+  subscription->callback = std::move(callback);
+  subscription->delivery = delivery;
+  subscription->coalescing_interval = coalescing_interval;
+  node_itr->second->subscriptions.push_back(subscription);
+  subscriptions_.emplace(subscription->id, subscription);
+
+  if (delivery == Delivery::DISPATCHER && !dispatcher_thread_.joinable())
+    dispatcher_thread_ = std::thread(&ParameterSubscriptions::runDispatcher, this);
+  return subscription->id;
+}
+
+bool ParameterSubscriptions::unsubscribe(uint64_t subscription_id)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto itr = subscriptions_.find(subscription_id);
+  if (itr == subscriptions_.end())
+    return false;
+
+  std::shared_ptr<Subscription> subscription = itr->second;
+  subscriptions_.erase(itr);
+  subscription->active = false;
+  subscription->pending_names.clear();
+
+  Node* node = subscription->node;
+  node->subscriptions.erase(std::find(node->subscriptions.begin(), node->subscriptions.end(), subscription));
+  if (node->subscriptions.empty())
+    nodes_.erase(nodes_.find(node->name_space));
+
+  // waiting for a call on this thread would never finish, as the callback itself or a callback it caused removes the subscription
+  std::thread::id this_thread = std::this_thread::get_id();
+  callback_condition_.wait(lock, [&subscription, this_thread] {
+    return std::all_of(subscription->calling_threads.begin(), subscription->calling_threads.end(),
+                       [this_thread](std::thread::id calling_thread) { return calling_thread == this_thread; });
+  });
+  return true;
+}
+
+void ParameterSubscriptions::collect(std::string_view parameter_name, Batch& batch) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (nodes_.empty())
+    return;
+
+  // the root namespace, every namespace on the path and the parameter itself
+  size_t separator = 0;
+  while (true)
+  {
+    auto node_itr = nodes_.find(parameter_name.substr(0, separator));
+    if (node_itr != nodes_.end())
+    {
+      for (const auto& subscription : node_itr->second->subscriptions)
+      {
+        auto index_itr = batch.entry_indices_.try_emplace(subscription.get(), batch.entries_.size()).first;
+        if (index_itr->second == batch.entries_.size())
+          batch.entries_.emplace_back(subscription, std::vector<std::string>());
+        batch.entries_[index_itr->second].second.emplace_back(parameter_name);
+      }
+    }
+    if (separator == parameter_name.size())
+      break;
+    separator = parameter_name.find('/', separator + 1);
+    if (separator == std::string_view::npos)
+      separator = parameter_name.size();
+  }
+}
+
+void ParameterSubscriptions::deliver(Batch& batch)
+{
+  bool notify_dispatcher = false;
+  // the remaining subscriptions are still notified if a callback throws, the first exception is rethrown afterwards
+  std::exception_ptr exception;
+  for (auto& entry : batch.entries_)
+  {
+    std::shared_ptr<Subscription>& subscription = entry.first;
+    std::vector<std::string>& names = entry.second;
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!subscription->active)
+      continue;
+    if (subscription->delivery == Delivery::SYNCHRONOUS)
+    {
+      std::exception_ptr callback_exception = notify(subscription, names, lock);
+      if (!exception)
+        exception = callback_exception;
+      continue;
+    }
+
+    if (subscription->pending_names.empty())
+    {
+      subscription->due_time = std::chrono::steady_clock::now() + subscription->coalescing_interval;
+      pending_subscriptions_.push_back(subscription);
+      notify_dispatcher = true;
+    }
+    subscription->pending_names.insert(std::make_move_iterator(names.begin()), std::make_move_iterator(names.end()));
+  }
+  batch.entries_.clear();
+  batch.entry_indices_.clear();
+
+  if (notify_dispatcher)
+    condition_.notify_one();
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+void ParameterSubscriptions::runDispatcher()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    condition_.wait(lock, [this] { return stop_ || !pending_subscriptions_.empty(); });
+    if (stop_)
+      return;
+
+    // subscriptions that have been removed or are not due yet stay pending, the earliest due time is awaited
+    auto now = std::chrono::steady_clock::now();
+    auto next_due_time = std::chrono::steady_clock::time_point::max();
+    std::vector<std::pair<std::shared_ptr<Subscription>, std::vector<std::string>>> notifications;
+    std::vector<std::shared_ptr<Subscription>> still_pending;
+    for (auto& subscription : pending_subscriptions_)
+    {
+      if (!subscription->active || subscription->pending_names.empty())
+        continue;
+      if (subscription->due_time > now)
+      {
+        next_due_time = std::min(next_due_time, subscription->due_time);
+        still_pending.push_back(std::move(subscription));
+        continue;
+      }
+      std::vector<std::string> names(std::make_move_iterator(subscription->pending_names.begin()), std::make_move_iterator(subscription->pending_names.end()));
+      subscription->pending_names.clear();
+      notifications.emplace_back(std::move(subscription), std::move(names));
+    }
+    pending_subscriptions_ = std::move(still_pending);
+
+    if (notifications.empty())
+    {
+      if (pending_subscriptions_.empty())
+        continue;
+      condition_.wait_until(lock, next_due_time, [this, next_due_time] {
+        return stop_ || (!pending_subscriptions_.empty() && pending_subscriptions_.back()->due_time < next_due_time);
+      });
+      continue;
+    }
+
+    for (const auto& notification : notifications)
+    {
+      // there is no caller to report an exception to, so it is discarded instead of terminating the dispatcher thread
+      if (notification.first->active)
+        notify(notification.first, notification.second, lock);
+    }
+  }
+}
+
+std::exception_ptr ParameterSubscriptions::notify(const std::shared_ptr<Subscription>& subscription, const std::vector<std::string>& names,
+                                    std::unique_lock<std::mutex>& lock)
+{
+  std::thread::id this_thread = std::this_thread::get_id();
+  subscription->calling_threads.push_back(this_thread);
+  lock.unlock();
+  std::exception_ptr exception;
+  try
+  {
+    subscription->callback(names);
+  }
+  catch (...)
+  {
+    exception = std::current_exception();
+  }
+  lock.lock();
+  subscription->calling_threads.erase(std::find(subscription->calling_threads.begin(), subscription->calling_threads.end(), this_thread));
+  callback_condition_.notify_all();
+  return exception;
+}
+
+}  // namespace paraminf
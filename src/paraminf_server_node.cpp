@@ -0,0 +1,48 @@
+#include <csignal>
+#include <iostream>
+
+#include "paraminf/parameter_server.h"
+#include "paraminf/yaml_io_handler.h"
+
+using namespace paraminf;
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " <socket_path> [yaml_file ...]" << std::endl;
+    return 1;
+  }
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  for (int i = 2; i < argc; i++)
+  {
+    if (!YamlIOHandler::readAndAddParametersFromFile(argv[i], *parameter_interface))
+    {
+      std::cerr << "Failed to load \"" << argv[i] << "\"" << std::endl;
+      return 1;
+    }
+  }
+
+  // block the termination signals before the server thread is started, s.t. they are only received by sigwait
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  try
+  {
+    ParameterServer server(argv[1], parameter_interface);
+    std::cout << "Serving " << parameter_interface->getAllParameterNames().size() << " parameters on " << argv[1] << std::endl;
+
+    int signal;
+    sigwait(&signals, &signal);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,308 @@
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+
+#include <yaml-cpp/yaml.h>
+
+#include "paraminf/partitioned_parameter_store.h"
+#include "paraminf/yaml_io_handler.h"
+#include "file_sync.h"
+#include "parallel_tasks.h"
+
+namespace paraminf
+{
+namespace
+{
+const std::string manifest_file_name = "manifest.yaml";
+
+bool fileExists(const std::string& file_path) { return access(file_path.c_str(), F_OK) == 0; }
+
+// writes the content to a temporary file, which replaces the file once it has been synced
+bool replaceFile(const std::string& file_path, const std::string& content)
+{
+  std::string temporary_file_path = file_path + ".tmp";
+  std::ofstream output_file(temporary_file_path, std::ios::binary | std::ios::trunc);
+  output_file << content;
+  output_file.close();
+  return output_file && renameDurably(temporary_file_path, file_path);
+}
+
+// derives a readable file name from the namespace, which is made unique by a counter
+std::string makeFileName(std::string_view partition_namespace, const std::set<std::string>& used_file_names)
+{
+  std::string stem = partition_namespace.empty() ? "root" : std::string(partition_namespace);
+  for (char& character : stem)
+  {
+    if (character == '/')
+      character = '.';
+    else if (!std::isalnum(static_cast<unsigned char>(character)) && character != '_' && character != '-')
+      character = '_';
+  }
+
+  std::string file_name = stem + ".yaml";
+  for (size_t counter = 2; used_file_names.count(file_name) > 0; counter++)
+  {
+    file_name = stem + "_" + std::to_string(counter) + ".yaml";
+  }
+  return file_name;
+}
+}  // namespace
+
+PartitionedParameterStore::PartitionedParameterStore(ParameterInterface::Ptr parameter_interface, const std::string& directory_path, size_t partition_depth,
+                                                     size_t thread_count)
+  : parameter_interface_(parameter_interface)
+  , directory_path_(directory_path)
+  , partition_depth_(partition_depth)
+  , thread_count_(resolveThreadCount(thread_count))
+{
+  if (!parameter_interface_)
+  {
+    throw std::invalid_argument("Parameter interface of the partitioned store must not be null");
+  }
+
+  size_t manifest_partition_depth;
+  if (fileExists(getManifestPath()) && !readManifest(partitions_, manifest_partition_depth))
+  {
+    throw std::runtime_error("Manifest " + getManifestPath() + " can not be read");
+  }
+  for (const auto& partition : partitions_)
+  {
+    changed_partitions_.insert(partition.first);
+  }
+
+  // subscribing first ensures that parameters added concurrently are either listed or notified
+  subscription_id_ = parameter_interface_->subscribe("", [this](const std::vector<std::string>& parameter_names) { markChanged(parameter_names); });
+  markChanged(parameter_interface_->getAllParameterNames());
+}
+
+PartitionedParameterStore::~PartitionedParameterStore() { parameter_interface_->unsubscribe(subscription_id_); }
+
+bool PartitionedParameterStore::load()
+{
+  std::lock_guard<std::mutex> persistence_lock(persistence_mutex_);
+  std::map<std::string, Partition, std::less<>> partitions;
+  size_t manifest_partition_depth;
+  if (!readManifest(partitions, manifest_partition_depth))
+    return false;
+
+  // the partitions share the thread safe string pool of the interface, s.t. merging them does not need to intern the strings again, but
+  // allocate from the default resource, as the resource of the interface might not be thread safe
+  std::vector<std::map<std::string, Partition, std::less<>>::iterator> partition_itrs;
+  std::vector<std::unique_ptr<ParameterInterface>> loaded_partitions;
+  for (auto itr = partitions.begin(); itr != partitions.end(); ++itr)
+  {
+    partition_itrs.push_back(itr);
+    loaded_partitions.push_back(std::make_unique<ParameterInterface>(parameter_interface_->getStringPool()));
+  }
+
+  std::atomic<bool> success{ true };
+  runInParallel(partition_itrs.size(), thread_count_, [&](size_t i) {
+    // the partitions are already read concurrently, so each one is parsed by a single thread
+    if (!YamlIOHandler::readAndAddParametersFromFile(getFilePath(partition_itrs[i]->second.file_name), *loaded_partitions[i], 1))
+    {
+      success = false;
+      return;
+    }
+    // the fingerprint only describes the partition if the files have been partitioned like the store partitions the interface
+    if (manifest_partition_depth == partition_depth_)
+      partition_itrs[i]->second.fingerprint = loaded_partitions[i]->getFingerprint();
+  });
+  if (!success)
+    return false;
+
+  for (auto& loaded_partition : loaded_partitions)
+  {
+    parameter_interface_->mergeParameters(std::move(*loaded_partition));
+  }
+
+  // partitions that are listed in the previous manifest only are still marked as changed and removed by the next save
+  for (auto& partition : partitions)
+  {
+    partitions_[partition.first] = partition.second;
+  }
+  return true;
+}
+
+bool PartitionedParameterStore::save()
+{
+  std::lock_guard<std::mutex> persistence_lock(persistence_mutex_);
+  std::set<std::string, std::less<>> changed_partitions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    changed_partitions.swap(changed_partitions_);
+  }
+  if (changed_partitions.empty())
+    return true;
+
+  std::map<std::string, ParameterInterface, std::less<>> copied_partitions = parameter_interface_->getPartitions(partition_depth_, &changed_partitions);
+
+  std::set<std::string> used_file_names = { manifest_file_name };
+  for (const auto& partition : partitions_)
+  {
+    used_file_names.insert(partition.second.file_name);
+  }
+
+  // partitions to write with their new fingerprint and names of the partitions that became empty
+  std::vector<std::pair<std::string, Partition>> written_partitions;
+  std::vector<const ParameterInterface*> written_parameters;
+  std::vector<std::string> removed_partitions;
+  for (const std::string& partition_namespace : changed_partitions)
+  {
+    auto existing_itr = partitions_.find(partition_namespace);
+    auto copied_itr = copied_partitions.find(partition_namespace);
+    if (copied_itr == copied_partitions.end())
+    {
+      if (existing_itr != partitions_.end())
+        removed_partitions.push_back(partition_namespace);
+      continue;
+    }
+
+    Partition partition;
+    partition.fingerprint = copied_itr->second.getFingerprint();
+    if (existing_itr != partitions_.end())
+    {
+      if (existing_itr->second.fingerprint == partition.fingerprint)
+        continue;
+      partition.file_name = existing_itr->second.file_name;
+    }
+    else
+    {
+      partition.file_name = makeFileName(partition_namespace, used_file_names);
+      used_file_names.insert(partition.file_name);
+    }
+    written_partitions.emplace_back(partition_namespace, std::move(partition));
+    written_parameters.push_back(&copied_itr->second);
+  }
+
+  // a newly created directory is only durable once its parent has been synced
+  if (!written_partitions.empty() && (mkdir(directory_path_.c_str(), 0755) == 0 ? !syncParentDirectory(directory_path_) : errno != EEXIST))
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    changed_partitions_.insert(changed_partitions.begin(), changed_partitions.end());
+    return false;
+  }
+
+  std::vector<char> written(written_partitions.size(), false);
+  runInParallel(written_partitions.size(), thread_count_, [&](size_t i) {
+    // the partitions are already written concurrently, so each one is emitted by a single thread
+    std::string yaml_output_string;
+    written[i] = YamlIOHandler::writeParametersToString(*written_parameters[i], yaml_output_string, 1) &&
+                 replaceFile(getFilePath(written_partitions[i].second.file_name), yaml_output_string);
+  });
+
+  // the manifest lists new partitions only after they have been written and removed ones before their files are deleted
+  std::map<std::string, Partition, std::less<>> partitions = partitions_;
+  std::vector<std::string> failed_partitions;
+  bool manifest_changed = !removed_partitions.empty();
+  for (size_t i = 0; i < written_partitions.size(); i++)
+  {
+    if (!written[i])
+    {
+      failed_partitions.push_back(written_partitions[i].first);
+      continue;
+    }
+    manifest_changed |= partitions.count(written_partitions[i].first) == 0;
+    partitions[written_partitions[i].first] = written_partitions[i].second;
+  }
+  for (const std::string& partition_namespace : removed_partitions)
+  {
+    partitions.erase(partition_namespace);
+  }
+
+  bool success = failed_partitions.empty();
+  if (manifest_changed && !writeManifest(partitions))
+  {
+    // only the rewritten partitions that have already been listed are up to date
+    for (auto& partition : partitions_)
+    {
+      auto itr = partitions.find(partition.first);
+      if (itr != partitions.end())
+        partition.second = itr->second;
+    }
+    for (const std::string& partition_namespace : removed_partitions)
+    {
+      failed_partitions.push_back(partition_namespace);
+    }
+    for (const auto& partition : partitions)
+    {
+      if (partitions_.count(partition.first) == 0)
+        failed_partitions.push_back(partition.first);
+    }
+    success = false;
+  }
+  else
+  {
+    for (const std::string& partition_namespace : removed_partitions)
+    {
+      std::remove(getFilePath(partitions_.at(partition_namespace).file_name).c_str());
+    }
+    partitions_ = std::move(partitions);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  changed_partitions_.insert(failed_partitions.begin(), failed_partitions.end());
+  write_count_ += std::count(written.begin(), written.end(), true);
+  return success;
+}
+
+size_t PartitionedParameterStore::getWriteCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return write_count_;
+}
+
+std::string PartitionedParameterStore::getManifestPath() const { return getFilePath(manifest_file_name); }
+
+void PartitionedParameterStore::markChanged(const std::vector<std::string>& parameter_names)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const std::string& parameter_name : parameter_names)
+  {
+    std::string_view partition_namespace = ParameterInterface::getPartitionNamespace(parameter_name, partition_depth_);
+    if (changed_partitions_.find(partition_namespace) == changed_partitions_.end())
+      changed_partitions_.emplace(partition_namespace);
+  }
+}
+
+bool PartitionedParameterStore::readManifest(std::map<std::string, Partition, std::less<>>& partitions, size_t& partition_depth) const
+{
+  try
+  {
+    YAML::Node manifest = YAML::LoadFile(getManifestPath());
+    partition_depth = manifest["partition_depth"].as<size_t>();
+    partitions.clear();
+    for (const auto& entry : manifest["partitions"])
+    {
+      partitions[entry.first.as<std::string>()].file_name = entry.second.as<std::string>();
+    }
+    return true;
+  }
+  catch (const YAML::Exception&)
+  {
+    return false;
+  }
+}
+
+bool PartitionedParameterStore::writeManifest(const std::map<std::string, Partition, std::less<>>& partitions) const
+{
+  YAML::Emitter emitter;
+  emitter << YAML::BeginMap;
+  emitter << YAML::Key << "partition_depth" << YAML::Value << partition_depth_;
+  emitter << YAML::Key << "partitions" << YAML::Value << YAML::BeginMap;
+  for (const auto& partition : partitions)
+  {
+    emitter << YAML::Key << YAML::DoubleQuoted << partition.first << YAML::Value << partition.second.file_name;
+  }
+  emitter << YAML::EndMap << YAML::EndMap;
+  return emitter.good() && replaceFile(getManifestPath(), emitter.c_str());
+}
+
+std::string PartitionedParameterStore::getFilePath(const std::string& file_name) const { return directory_path_ + "/" + file_name; }
+
+}  // namespace paraminf
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#include "paraminf/parameter_io_backend.h"
+#include "paraminf/raw_parameter_value.h"
+
+namespace paraminf
+{
+namespace
+{
+template <typename T>
+bool parseScalar(std::string_view text, T& value)
+{
+  if constexpr (std::is_same_v<T, int>)
+    return ParameterIOBackend::parseInt(text, value);
+  else if constexpr (std::is_same_v<T, double>)
+    return ParameterIOBackend::parseDouble(text, value);
+  else if constexpr (std::is_same_v<T, bool>)
+    return ParameterIOBackend::parseBool(text, value);
+  else
+  {
+    value = std::string(text);
+    return true;
+  }
+}
+
+template <typename T>
+std::any convertScalarTo(std::string_view text)
+{
+  T value;
+  if (!parseScalar(text, value))
+    return std::any();
+  return value;
+}
+
+template <typename T>
+std::any convertSequenceTo(const std::vector<std::string_view>& elements)
+{
+  std::vector<T> values(elements.size());
+  for (size_t i = 0; i < elements.size(); i++)
+  {
+    T value;
+    if (!parseScalar(elements[i], value))
+      return std::any();
+    values[i] = std::move(value);
+  }
+  return values;
+}
+}  // namespace
+
+// each record is directly followed by its data, the records of a block are consecutive and aligned to the record
+struct RawParameterValue::Record
+{
+  // successful conversion to one type, the list only grows and is released with the storage
+  struct CachedValue
+  {
+    std::any value;
+    const CachedValue* next;
+  };
+
+  Storage* storage;
+  // at most one entry per supported type unless the first conversions of a type race
+  std::atomic<const CachedValue*> cached_values;
+  uint32_t size;
+  bool is_sequence;
+
+  const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+  static size_t recordSize(size_t data_size) { return (sizeof(Record) + data_size + alignof(Record) - 1) / alignof(Record) * alignof(Record); }
+};
+
+struct RawParameterValue::Storage
+{
+  struct Block
+  {
+    char* data;
+    size_t size;
+    size_t used;
+  };
+
+  // the builder and each value hold a reference
+  std::atomic<size_t> references{ 1 };
+  std::vector<Block> blocks;
+
+  ~Storage()
+  {
+    for (const auto& block : blocks)
+    {
+      for (size_t offset = 0; offset < block.used;)
+      {
+        Record* record = reinterpret_cast<Record*>(block.data + offset);
+        offset += Record::recordSize(record->size);
+        for (const Record::CachedValue* cached_value = record->cached_values.load(std::memory_order_relaxed); cached_value;)
+        {
+          const Record::CachedValue* next = cached_value->next;
+          delete cached_value;
+          cached_value = next;
+        }
+        record->~Record();
+      }
+      ::operator delete(block.data);
+    }
+  }
+
+  static void release(Storage* storage)
+  {
+    if (storage->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete storage;
+  }
+};
+
+RawParameterValue::Builder::Builder() : storage_(new Storage()) {}
+
+RawParameterValue::Builder::~Builder() { Storage::release(storage_); }
+
+RawParameterValue RawParameterValue::Builder::addScalar(std::string_view text)
+{
+  Record* record = allocateRecord(text.size(), false);
+  text.copy(const_cast<char*>(record->data()), text.size());
+  return RawParameterValue(record);
+}
+
+RawParameterValue RawParameterValue::Builder::addSequence(const std::vector<std::string_view>& elements)
+{
+  // the elements are stored consecutively, each prefixed by its size
+  size_t data_size = 0;
+  for (const auto& element : elements)
+  {
+    data_size += sizeof(uint32_t) + element.size();
+  }
+  Record* record = allocateRecord(data_size, true);
+  char* data = const_cast<char*>(record->data());
+  for (const auto& element : elements)
+  {
+    uint32_t size = static_cast<uint32_t>(element.size());
+    std::memcpy(data, &size, sizeof(uint32_t));
+    element.copy(data + sizeof(uint32_t), element.size());
+    data += sizeof(uint32_t) + element.size();
+  }
+  return RawParameterValue(record);
+}
+
+RawParameterValue::Record* RawParameterValue::Builder::allocateRecord(size_t data_size, bool is_sequence)
+{
+  // blocks grow geometrically, s.t. small loads stay small and large loads need few allocations
+  const size_t min_block_size = 4096;
+  const size_t max_block_size = 1024 * 1024;
+
+  if (data_size > std::numeric_limits<uint32_t>::max())
+    throw std::length_error("Raw parameter value must not exceed 4 GB");
+  size_t record_size = Record::recordSize(data_size);
+  if (storage_->blocks.empty() || storage_->blocks.back().size - storage_->blocks.back().used < record_size)
+  {
+    size_t block_size = storage_->blocks.empty() ? min_block_size : std::min(2 * storage_->blocks.back().size, max_block_size);
+    block_size = std::max(block_size, record_size);
+    storage_->blocks.push_back({ static_cast<char*>(::operator new(block_size)), block_size, 0 });
+  }
+
+  Storage::Block& block = storage_->blocks.back();
+  Record* record = new (block.data + block.used) Record{ storage_, { nullptr }, static_cast<uint32_t>(data_size), is_sequence };
+  block.used += record_size;
+  storage_->references.fetch_add(1, std::memory_order_relaxed);
+  return record;
+}
+
+RawParameterValue::RawParameterValue(const RawParameterValue& other) : record_(other.record_)
+{
+  if (record_)
+    record_->storage->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+RawParameterValue::~RawParameterValue()
+{
+  if (record_)
+    Storage::release(record_->storage);
+}
+
+RawParameterValue& RawParameterValue::operator=(const RawParameterValue& other)
+{
+  RawParameterValue copy(other);
+  std::swap(record_, copy.record_);
+  return *this;
+}
+
+RawParameterValue& RawParameterValue::operator=(RawParameterValue&& other) noexcept
+{
+  std::swap(record_, other.record_);
+  return *this;
+}
+
+bool RawParameterValue::isSequence() const { return record_ && record_->is_sequence; }
+
+std::string_view RawParameterValue::getText() const { return record_ ? std::string_view(record_->data(), record_->size) : std::string_view(); }
+
+std::vector<std::string_view> RawParameterValue::getElements() const
+{
+  std::vector<std::string_view> elements;
+  std::string_view data = getText();
+  while (data.size() >= sizeof(uint32_t))
+  {
+    uint32_t size;
+    std::memcpy(&size, data.data(), sizeof(uint32_t));
+    elements.push_back(data.substr(sizeof(uint32_t), size));
+    data.remove_prefix(sizeof(uint32_t) + size);
+  }
+  return elements;
+}
+
+std::any RawParameterValue::convertTo(const std::type_info& type) const
+{
+  const Record::CachedValue* cached_values = record_ ? record_->cached_values.load(std::memory_order_acquire) : nullptr;
+  for (const Record::CachedValue* cached_value = cached_values; cached_value; cached_value = cached_value->next)
+  {
+    if (cached_value->value.type() == type)
+      return cached_value->value;
+  }
+
+  std::any value;
+  if (!isSequence())
+  {
+    if (type == typeid(int))
+      value = convertScalarTo<int>(getText());
+    else if (type == typeid(double))
+      value = convertScalarTo<double>(getText());
+    else if (type == typeid(bool))
+      value = convertScalarTo<bool>(getText());
+    else if (type == typeid(std::string))
+      value = convertScalarTo<std::string>(getText());
+  }
+  else
+  {
+    std::vector<std::string_view> elements = getElements();
+    if (type == typeid(std::vector<int>))
+      value = convertSequenceTo<int>(elements);
+    else if (type == typeid(std::vector<double>))
+      value = convertSequenceTo<double>(elements);
+    else if (type == typeid(std::vector<bool>))
+      value = convertSequenceTo<bool>(elements);
+    else if (type == typeid(std::vector<std::string>))
+      value = convertSequenceTo<std::string>(elements);
+  }
+
+  // the conversion is prepended to the cached values, a concurrent first conversion of the same type only adds a redundant entry
+  if (value.has_value() && record_)
+  {
+    auto* new_cached_value = new Record::CachedValue{ value, cached_values };
+    while (!record_->cached_values.compare_exchange_weak(new_cached_value->next, new_cached_value, std::memory_order_acq_rel,
+                                                          std::memory_order_acquire))
+    {
+    }
+  }
+  return value;
+}
+
+std::any RawParameterValue::resolve() const
+{
+  if (isSequence())
+    return ParameterIOBackend::convertSequence(getElements());
+  return ParameterIOBackend::convertScalar(getText());
+}
+
+}  // namespace paraminf
@@ -0,0 +1,293 @@
+#include <cerrno>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "paraminf/parameter_codec.h"
+#include "paraminf/shared_memory_parameter_store.h"
+
+namespace paraminf
+{
+namespace
+{
+constexpr uint64_t SEGMENT_MAGIC = 0x50415241'4d494e46;  // "PARAMINF"
+
+std::runtime_error systemError(const std::string& message, const std::string& name)
+{
+  return std::runtime_error(message + " \"" + name + "\": " + std::strerror(errno));
+}
+}  // namespace
+
+struct SharedMemoryParameterStore::SegmentHeader
+{
+  uint64_t magic;
+  uint64_t capacity;
+  // odd while a publish is in progress
+  std::atomic<uint64_t> sequence;
+  uint64_t entry_count;
+  uint64_t payload_size;
+};
+
+struct SharedMemoryParameterStore::IndexEntry
+{
+  uint64_t name_offset;
+  uint64_t value_offset;
+  uint32_t name_size;
+  uint32_t value_size;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Sequence lock in shared memory requires lock free atomics");
+
+SharedMemoryParameterStore::SharedMemoryParameterStore(const std::string& name, size_t capacity) : name_(name), is_writer_(true)
+{
+  // remove a stale segment s.t. readers of the old segment never observe a change of its size
+  shm_unlink(name_.c_str());
+
+  file_descriptor_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (file_descriptor_ < 0)
+    throw systemError("Failed to create shared memory segment", name_);
+
+  size_t segment_size = sizeof(SegmentHeader) + capacity;
+  if (ftruncate(file_descriptor_, static_cast<off_t>(segment_size)) != 0)
+  {
+    std::runtime_error error = systemError("Failed to resize shared memory segment", name_);
+    close(file_descriptor_);
+    shm_unlink(name_.c_str());
+    throw error;
+  }
+  map(segment_size, true);
+
+  header_->capacity = capacity;
+  header_->sequence.store(0);
+  header_->entry_count = 0;
+  header_->payload_size = 0;
+  // readers only accept the segment once the header is initialized
+  std::atomic_thread_fence(std::memory_order_release);
+  header_->magic = SEGMENT_MAGIC;
+}
+
+SharedMemoryParameterStore::SharedMemoryParameterStore(const std::string& name, std::chrono::milliseconds read_timeout)
+  : name_(name), is_writer_(false), read_timeout_(read_timeout)
+{
+  file_descriptor_ = shm_open(name_.c_str(), O_RDONLY, 0);
+  if (file_descriptor_ < 0)
+    throw systemError("Failed to open shared memory segment", name_);
+
+  struct stat segment_stat;
+  if (fstat(file_descriptor_, &segment_stat) != 0 || static_cast<size_t>(segment_stat.st_size) < sizeof(SegmentHeader))
+  {
+    close(file_descriptor_);
+    throw std::runtime_error("Shared memory segment \"" + name_ + "\" is not a parameter store");
+  }
+  map(segment_stat.st_size, false);
+
+  if (header_->magic != SEGMENT_MAGIC || sizeof(SegmentHeader) + header_->capacity != segment_size_)
+  {
+    munmap(segment_, segment_size_);
+    close(file_descriptor_);
+    throw std::runtime_error("Shared memory segment \"" + name_ + "\" is not a parameter store");
+  }
+}
+
+SharedMemoryParameterStore::~SharedMemoryParameterStore()
+{
+  munmap(segment_, segment_size_);
+  close(file_descriptor_);
+  if (is_writer_)
+    shm_unlink(name_.c_str());
+}
+
+bool SharedMemoryParameterStore::publish(const ParameterInterface& parameter_interface)
+{
+  if (!is_writer_)
+    return false;
+
+  // encode a consistent copy of the parameters before entering the critical section
+  ParameterInterface snapshot(parameter_interface);
+  std::vector<std::string> parameter_names = snapshot.getAllParameterNames();
+
+  std::vector<IndexEntry> index(parameter_names.size());
+  std::string data;
+  uint64_t data_offset = parameter_names.size() * sizeof(IndexEntry);
+  for (size_t i = 0; i < parameter_names.size(); i++)
+  {
+    index[i].name_offset = data_offset + data.size();
+    index[i].name_size = static_cast<uint32_t>(parameter_names[i].size());
+    data.append(parameter_names[i]);
+
+    size_t value_start = data.size();
+    if (!ParameterCodec::encodeParameter(snapshot, parameter_names[i], data))
+      return false;
+    index[i].value_offset = data_offset + value_start;
+    index[i].value_size = static_cast<uint32_t>(data.size() - value_start);
+  }
+
+  size_t payload_size = data_offset + data.size();
+  if (payload_size > header_->capacity)
+    return false;
+
+  uint64_t sequence = header_->sequence.load(std::memory_order_relaxed);
+  header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  std::memcpy(payload_, index.data(), data_offset);
+  std::memcpy(payload_ + data_offset, data.data(), data.size());
+  header_->entry_count = index.size();
+  header_->payload_size = payload_size;
+
+  header_->sequence.store(sequence + 2, std::memory_order_release);
+  return true;
+}
+
+bool SharedMemoryParameterStore::hasParam(const std::string& parameter_name) const
+{
+  std::string encoded_value;
+  bool found;
+  uint64_t sequence;
+  auto deadline = std::chrono::steady_clock::now() + read_timeout_;
+  do
+  {
+    if (!beginRead(sequence, deadline))
+      return false;
+    found = findEncodedValue(parameter_name, encoded_value);
+  } while (!endRead(sequence));
+  return found;
+}
+
+std::vector<std::string> SharedMemoryParameterStore::getAllParameterNames() const
+{
+  ParameterInterface parameter_interface;
+  readAll(parameter_interface);
+  return parameter_interface.getAllParameterNames();
+}
+
+bool SharedMemoryParameterStore::readAll(ParameterInterface& parameter_interface) const
+{
+  std::string payload;
+  uint64_t entry_count;
+  uint64_t sequence;
+  auto deadline = std::chrono::steady_clock::now() + read_timeout_;
+  do
+  {
+    if (!beginRead(sequence, deadline))
+      return false;
+    entry_count = header_->entry_count;
+    size_t payload_size = std::min<uint64_t>(header_->payload_size, header_->capacity);
+    payload.assign(payload_, payload_size);
+  } while (!endRead(sequence));
+
+  // the copy is consistent, so the entries can be decoded without further synchronization
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  for (uint64_t i = 0; i < entry_count; i++)
+  {
+    IndexEntry entry;
+    if ((i + 1) * sizeof(IndexEntry) > payload.size())
+      break;
+    std::memcpy(&entry, payload.data() + i * sizeof(IndexEntry), sizeof(IndexEntry));
+    if (entry.name_offset + entry.name_size > payload.size() || entry.value_offset + entry.value_size > payload.size())
+      continue;
+
+    std::any value;
+    size_t offset = entry.value_offset;
+    if (ParameterCodec::decodeValue(payload.data(), entry.value_offset + entry.value_size, offset, value))
+      transaction.setParam(payload.substr(entry.name_offset, entry.name_size), value);
+  }
+  transaction.commit();
+  return true;
+}
+
+uint64_t SharedMemoryParameterStore::getVersion() const { return header_->sequence.load(std::memory_order_acquire) / 2; }
+
+void SharedMemoryParameterStore::map(size_t segment_size, bool writable)
+{
+  segment_size_ = segment_size;
+  segment_ = mmap(nullptr, segment_size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, file_descriptor_, 0);
+  if (segment_ == MAP_FAILED)
+  {
+    std::runtime_error error = systemError("Failed to map shared memory segment", name_);
+    close(file_descriptor_);
+    if (writable)
+      shm_unlink(name_.c_str());
+    throw error;
+  }
+  header_ = static_cast<SegmentHeader*>(segment_);
+  payload_ = static_cast<char*>(segment_) + sizeof(SegmentHeader);
+}
+
+bool SharedMemoryParameterStore::beginRead(uint64_t& sequence, std::chrono::steady_clock::time_point deadline) const
+{
+  while (true)
+  {
+    sequence = header_->sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) == 0)
+      return true;
+    // a writer that died while publishing never finishes, so the reader gives up instead of waiting forever
+    if (std::chrono::steady_clock::now() >= deadline)
+      return false;
+    std::this_thread::yield();
+  }
+}
+
+bool SharedMemoryParameterStore::endRead(uint64_t sequence) const
+{
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return header_->sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+bool SharedMemoryParameterStore::findEncodedValue(const std::string& parameter_name, std::string& encoded_value) const
+{
+  uint64_t capacity = header_->capacity;
+  uint64_t entry_count = header_->entry_count;
+  if (entry_count > capacity / sizeof(IndexEntry))
+    return false;
+
+  // binary search over the sorted index, all offsets are checked as the data may be modified concurrently
+  uint64_t lower = 0;
+  uint64_t upper = entry_count;
+  while (lower < upper)
+  {
+    uint64_t middle = lower + (upper - lower) / 2;
+    IndexEntry entry;
+    std::memcpy(&entry, payload_ + middle * sizeof(IndexEntry), sizeof(IndexEntry));
+    if (entry.name_offset > capacity || capacity - entry.name_offset < entry.name_size)
+      return false;
+
+    int comparison = std::string_view(payload_ + entry.name_offset, entry.name_size).compare(parameter_name);
+    if (comparison < 0)
+      lower = middle + 1;
+    else if (comparison > 0)
+      upper = middle;
+    else
+    {
+      if (entry.value_offset > capacity || capacity - entry.value_offset < entry.value_size)
+        return false;
+      encoded_value.assign(payload_ + entry.value_offset, entry.value_size);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SharedMemoryParameterStore::readValue(const std::string& parameter_name, std::any& value) const
+{
+  std::string encoded_value;
+  bool found;
+  uint64_t sequence;
+  auto deadline = std::chrono::steady_clock::now() + read_timeout_;
+  do
+  {
+    if (!beginRead(sequence, deadline))
+      return false;
+    found = findEncodedValue(parameter_name, encoded_value);
+  } while (!endRead(sequence));
+
+  size_t offset = 0;
+  return found && ParameterCodec::decodeValue(encoded_value.data(), encoded_value.size(), offset, value);
+}
+
+}  // namespace paraminf
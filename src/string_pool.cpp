@@ -0,0 +1,182 @@
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#include "paraminf/string_pool.h"
+
+namespace paraminf
+{
+struct StringPool::State
+{
+  std::mutex mutex;
+  // open addressing table with linear probing, the number of slots is a power of two and at most half of them are used
+  std::vector<Entry*> slots;
+  size_t entry_count = 0;
+  size_t entry_bytes = 0;
+  // the pool and each entry hold a reference, s.t. handles can outlive the pool
+  size_t references = 1;
+  std::shared_ptr<std::pmr::memory_resource> memory_resource;
+
+  explicit State(std::shared_ptr<std::pmr::memory_resource> memory_resource) : memory_resource(std::move(memory_resource)) {}
+
+  Entry* find(std::string_view value, size_t hash) const
+  {
+    if (slots.empty())
+      return nullptr;
+    size_t mask = slots.size() - 1;
+    for (size_t i = hash & mask; slots[i]; i = (i + 1) & mask)
+    {
+      if (slots[i]->hash == hash && std::string_view(slots[i]->data(), slots[i]->size) == value)
+        return slots[i];
+    }
+    return nullptr;
+  }
+
+  void insert(Entry* entry)
+  {
+    if ((entry_count + 1) * 2 > slots.size())
+      rehash(std::max<size_t>(16, slots.size() * 2));
+    size_t mask = slots.size() - 1;
+    size_t i = entry->hash & mask;
+    while (slots[i])
+    {
+      i = (i + 1) & mask;
+    }
+    slots[i] = entry;
+    entry_count++;
+  }
+
+  void erase(Entry* entry)
+  {
+    size_t mask = slots.size() - 1;
+    size_t i = entry->hash & mask;
+    while (slots[i] != entry)
+    {
+      i = (i + 1) & mask;
+    }
+
+    // shift the following entries of the probe sequence back instead of leaving a tombstone
+    for (size_t j = (i + 1) & mask; slots[j]; j = (j + 1) & mask)
+    {
+      size_t home = slots[j]->hash & mask;
+      bool home_between = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+      if (!home_between)
+      {
+        slots[i] = slots[j];
+        i = j;
+      }
+    }
+    slots[i] = nullptr;
+    entry_count--;
+  }
+
+  void rehash(size_t slot_count)
+  {
+    std::vector<Entry*> old_slots(slot_count, nullptr);
+    std::swap(slots, old_slots);
+    size_t mask = slots.size() - 1;
+    for (Entry* entry : old_slots)
+    {
+      if (!entry)
+        continue;
+      size_t i = entry->hash & mask;
+      while (slots[i])
+      {
+        i = (i + 1) & mask;
+      }
+      slots[i] = entry;
+    }
+  }
+};
+
+// the global heap is not owned by the shared pointer
+StringPool::StringPool() : StringPool(std::shared_ptr<std::pmr::memory_resource>(std::shared_ptr<void>(), std::pmr::new_delete_resource())) {}
+
+StringPool::StringPool(std::shared_ptr<std::pmr::memory_resource> memory_resource)
+{
+  if (!memory_resource)
+    throw std::invalid_argument("Memory resource of the string pool must not be null");
+  state_ = new State(std::move(memory_resource));
+}
+
+StringPool::~StringPool()
+{
+  bool last_reference;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    last_reference = --state_->references == 0;
+  }
+  if (last_reference)
+    delete state_;
+}
+
+InternedString StringPool::intern(std::string_view value)
+{
+  if (value.empty())
+    return InternedString();
+  if (value.size() > std::numeric_limits<uint32_t>::max())
+    throw std::length_error("String is too long to be interned");
+
+  size_t hash = std::hash<std::string_view>()(value);
+  std::lock_guard<std::mutex> lock(state_->mutex);
+
+  // the reference count of entries in the table is never zero, since the last reference is only dropped while holding the lock
+  if (Entry* entry = state_->find(value, hash))
+  {
+    entry->references.fetch_add(1, std::memory_order_relaxed);
+    return InternedString(entry);
+  }
+
+  size_t entry_bytes = sizeof(Entry) + value.size() + 1;
+  Entry* entry = new (state_->memory_resource->allocate(entry_bytes, alignof(Entry))) Entry{ { 1 }, static_cast<uint32_t>(value.size()), hash, state_ };
+  char* data = reinterpret_cast<char*>(entry + 1);
+  value.copy(data, value.size());
+  data[value.size()] = '\0';
+
+  state_->insert(entry);
+  state_->entry_bytes += entry_bytes;
+  state_->references++;
+  return InternedString(entry);
+}
+
+size_t StringPool::size() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->entry_count;
+}
+
+size_t StringPool::getMemoryUsage() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->entry_bytes + state_->slots.capacity() * sizeof(Entry*);
+}
+
+void StringPool::release(Entry* entry)
+{
+  // references that are not the last one can be dropped without the lock
+  uint32_t references = entry->references.load(std::memory_order_relaxed);
+  while (references > 1)
+  {
+    if (entry->references.compare_exchange_weak(references, references - 1, std::memory_order_acq_rel))
+      return;
+  }
+
+  State* state = entry->state;
+  bool last_reference;
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    // the string might have been interned again while waiting for the lock
+    if (entry->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+      return;
+    state->erase(entry);
+    size_t entry_bytes = sizeof(Entry) + entry->size + 1;
+    state->entry_bytes -= entry_bytes;
+    entry->~Entry();
+    state->memory_resource->deallocate(entry, entry_bytes, alignof(Entry));
+    last_reference = --state->references == 0;
+  }
+  if (last_reference)
+    delete state;
+}
+
+}  // namespace paraminf
@@ -3,25 +3,188 @@
 #include <fstream>
 #include <vector>
 #include <cmath>
+#include <atomic>
+#include <string_view>
+#include <algorithm>
+#include <cctype>
+#include <iterator>
 
 #include <yaml-cpp/yaml.h>
 
-#include <boost/algorithm/string.hpp>
-
 #include "paraminf/yaml_io_handler.h"
+#include "parallel_tasks.h"
 
 namespace paraminf
 {
+namespace
+{
+std::string_view topLevelNamespace(const std::string& parameter_name) { return std::string_view(parameter_name).substr(0, parameter_name.find('/')); }
+
+// returns true if the line consists of the marker followed by whitespace, a comment or further content
+bool isMarkerLine(std::string_view line, std::string_view marker)
+{
+  return line.substr(0, marker.size()) == marker && (line.size() == marker.size() || line[marker.size()] == ' ' || line[marker.size()] == '\t' || line[marker.size()] == '\r');
+}
+
+// returns true if the line starts with a plain or quoted key in the first column
+bool isKeyLine(std::string_view line)
+{
+  unsigned char first = line.front();
+  return (std::isalnum(first) || first == '_' || first == '"' || first == '\'') && line.find(':') != std::string_view::npos;
+}
+
+/**
+ * Returns the offsets of the lines at which the input can be split into chunks that can be parsed on their own. These are the
+ * document start markers and the top-level keys of documents that are block mappings in the first column. Documents with content
+ * behind the start marker, e.g. a block scalar whose lines might start in the first column, are not split. Directives apply to the
+ * following document, so inputs with directives are not split at all.
+ */
+std::vector<size_t> findSplitOffsets(std::string_view input)
+{
+  std::vector<size_t> split_offsets;
+  // no content of the current document has been found yet
+  bool awaiting_content = true;
+  bool is_block_mapping = false;
+  for (size_t line_begin = 0; line_begin < input.size();)
+  {
+    size_t line_end = std::min(input.find('\n', line_begin), input.size());
+    std::string_view line = input.substr(line_begin, line_end - line_begin);
+    size_t content_begin = line.find_first_not_of(" \t\r");
+    if (content_begin == std::string_view::npos || line[content_begin] == '#')
+    {
+      // blank lines and comments do not belong to any node
+    }
+    else if (line.front() == '%')
+      return {};
+    else if (isMarkerLine(line, "---"))
+    {
+      if (line_begin > 0)
+        split_offsets.push_back(line_begin);
+      size_t marker_content_begin = line.find_first_not_of(" \t\r", 3);
+      awaiting_content = marker_content_begin == std::string_view::npos || line[marker_content_begin] == '#';
+      is_block_mapping = false;
+    }
+    else if (isMarkerLine(line, "..."))
+    {
+      awaiting_content = false;
+      is_block_mapping = false;
+    }
+    else if (awaiting_content)
+    {
+      is_block_mapping = content_begin == 0 && isKeyLine(line);
+      awaiting_content = false;
+    }
+    else if (is_block_mapping && content_begin == 0 && isKeyLine(line))
+      split_offsets.push_back(line_begin);
+    line_begin = line_end + 1;
+  }
+  return split_offsets;
+}
+}  // namespace
+
 bool YamlIOHandler::readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface)
 {
-  try
+  return readAndAddParametersFromFile(yaml_file_path, parameter_interface, 0);
+}
+
+bool YamlIOHandler::readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface, size_t thread_count)
+{
+  std::ifstream input_file(yaml_file_path, std::ios::binary);
+  if (!input_file)
+    return false;
+  std::string yaml_input_string((std::istreambuf_iterator<char>(input_file)), std::istreambuf_iterator<char>());
+  if (input_file.bad())
+    return false;
+  return readAndAddParametersFromString(yaml_input_string, parameter_interface, thread_count);
+}
+
+bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface)
+{
+  return readAndAddParametersFromString(yaml_input_string, parameter_interface, 0);
+}
+
+bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface, size_t thread_count)
+{
+  // chunks smaller than this are not worth the overhead of a thread
+  const size_t min_chunk_size = 64 * 1024;
+
+  auto parse_sequentially = [&]() {
+    try
+    {
+      std::vector<YAML::Node> parameter_nodes = YAML::LoadAll(yaml_input_string);
+
+      for (auto& node : parameter_nodes)
+      {
+        evaluateNode(node, "", parameter_interface);
+      }
+      return true;
+    }
+    catch (...)
+    {
+      return false;
+    }
+  };
+
+  thread_count = std::min(resolveThreadCount(thread_count), yaml_input_string.size() / min_chunk_size);
+  if (thread_count <= 1)
+    return parse_sequentially();
+
+  // several chunks per thread balance top-level namespaces of different size
+  size_t target_chunk_size = std::max(min_chunk_size / 4, yaml_input_string.size() / (4 * thread_count));
+  std::vector<size_t> chunk_begins = { 0 };
+  for (size_t split_offset : findSplitOffsets(yaml_input_string))
   {
-    std::vector<YAML::Node> parameter_nodes = YAML::LoadAllFromFile(yaml_file_path);
+    if (split_offset - chunk_begins.back() >= target_chunk_size)
+      chunk_begins.push_back(split_offset);
+  }
+  if (chunk_begins.size() == 1)
+    return parse_sequentially();
+  chunk_begins.push_back(yaml_input_string.size());
 
-    for (auto& node : parameter_nodes)
+  // the chunks share the thread safe string pool of the interface, s.t. merging them does not need to intern the strings again, but
+  // allocate from the default resource, as the resource of the interface might not be thread safe
+  size_t chunk_count = chunk_begins.size() - 1;
+  std::vector<std::unique_ptr<ParameterInterface>> chunk_parameters(chunk_count);
+  std::atomic<bool> success{ true };
+  runInParallel(chunk_count, thread_count, [&](size_t i) {
+    if (!success)
+      return;
+    try
     {
-      evaluateNode(node, "", parameter_interface);
+      chunk_parameters[i] = std::make_unique<ParameterInterface>(parameter_interface.getStringPool());
+      std::vector<YAML::Node> parameter_nodes = YAML::LoadAll(yaml_input_string.substr(chunk_begins[i], chunk_begins[i + 1] - chunk_begins[i]));
+
+      // a chunk starting with a key continues the block mapping of the previous chunk, which any other result contradicts
+      bool continues_document = i > 0 && yaml_input_string[chunk_begins[i]] != '-';
+      if (continues_document && (parameter_nodes.empty() || !parameter_nodes.front().IsMap()))
+        throw std::invalid_argument("Chunk does not continue a block mapping");
+      for (auto& node : parameter_nodes)
+      {
+        evaluateNode(node, "", *chunk_parameters[i]);
+      }
+    }
+    catch (...)
+    {
+      success = false;
     }
+  });
+
+  // the errors and the parameters added before them are only reproduced exactly by parsing the whole input
+  if (!success)
+    return parse_sequentially();
+
+  for (auto& parameters : chunk_parameters)
+  {
+    parameter_interface.mergeParameters(std::move(*parameters));
+  }
+  return true;
+}
+
+bool YamlIOHandler::readAndAddParametersFromNode(const YAML::Node& node, ParameterInterface& parameter_interface)
+{
+  try
+  {
+    evaluateNode(node, "", parameter_interface);
     return true;
   }
   catch (...)
@@ -30,17 +193,14 @@ bool YamlIOHandler::readAndAddParametersFromFile(const std::string& yaml_file_pa
   }
 }
 
-bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface)
+bool YamlIOHandler::readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface,
+                                                 ParameterIOBackend::Conversion conversion)
 {
+  if (conversion == ParameterIOBackend::Conversion::EAGER)
+    return readAndAddParametersFromFile(yaml_file_path, parameter_interface);
   try
   {
-    std::vector<YAML::Node> parameter_nodes = YAML::LoadAll(yaml_input_string);
-
-    for (auto& node : parameter_nodes)
-    {
-      evaluateNode(node, "", parameter_interface);
-    }
-    return true;
+    return readAndAddParametersDeferred(YAML::LoadAllFromFile(yaml_file_path), parameter_interface);
   }
   catch (...)
   {
@@ -48,12 +208,14 @@ bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input
   }
 }
 
-bool YamlIOHandler::readAndAddParametersFromNode(const YAML::Node& node, ParameterInterface& parameter_interface)
+bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface,
+                                                   ParameterIOBackend::Conversion conversion)
 {
+  if (conversion == ParameterIOBackend::Conversion::EAGER)
+    return readAndAddParametersFromString(yaml_input_string, parameter_interface);
   try
   {
-    evaluateNode(node, "", parameter_interface);
-    return true;
+    return readAndAddParametersDeferred(YAML::LoadAll(yaml_input_string), parameter_interface);
   }
   catch (...)
   {
@@ -61,68 +223,181 @@ bool YamlIOHandler::readAndAddParametersFromNode(const YAML::Node& node, Paramet
   }
 }
 
-bool YamlIOHandler::writeParametersToFile(const std::string& yaml_file_path, const ParameterInterface& parameter_interface)
+bool YamlIOHandler::readAndAddParametersFromFile(const std::string& yaml_file_path, ParameterInterface& parameter_interface, const ParameterSchema& schema,
+                                                 std::vector<std::string>& errors)
 {
+  std::vector<YAML::Node> parameter_nodes;
   try
   {
-    YAML::Emitter yaml;
+    parameter_nodes = YAML::LoadAllFromFile(yaml_file_path);
+  }
+  catch (const std::exception& e)
+  {
+    errors.push_back("Failed to load \"" + yaml_file_path + "\": " + e.what());
+    return false;
+  }
+  return readAndAddParametersWithSchema(parameter_nodes, parameter_interface, schema, errors);
+}
+
+bool YamlIOHandler::readAndAddParametersFromString(const std::string& yaml_input_string, ParameterInterface& parameter_interface, const ParameterSchema& schema,
+                                                   std::vector<std::string>& errors)
+{
+  std::vector<YAML::Node> parameter_nodes;
+  try
+  {
+    parameter_nodes = YAML::LoadAll(yaml_input_string);
+  }
+  catch (const std::exception& e)
+  {
+    errors.push_back(std::string("Failed to parse YAML string: ") + e.what());
+    return false;
+  }
+  return readAndAddParametersWithSchema(parameter_nodes, parameter_interface, schema, errors);
+}
+
+bool YamlIOHandler::readSchemaFromFile(const std::string& yaml_file_path, ParameterSchema& schema, std::vector<std::string>& errors)
+{
+  size_t previous_error_count = errors.size();
+  try
+  {
+    for (const auto& node : YAML::LoadAllFromFile(yaml_file_path))
+    {
+      evaluateSchemaNode(node, "", schema, errors);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    errors.push_back("Failed to load schema \"" + yaml_file_path + "\": " + e.what());
+  }
+  return errors.size() == previous_error_count;
+}
+
+bool YamlIOHandler::readSchemaFromString(const std::string& yaml_input_string, ParameterSchema& schema, std::vector<std::string>& errors)
+{
+  size_t previous_error_count = errors.size();
+  try
+  {
+    for (const auto& node : YAML::LoadAll(yaml_input_string))
+    {
+      evaluateSchemaNode(node, "", schema, errors);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    errors.push_back(std::string("Failed to parse schema string: ") + e.what());
+  }
+  return errors.size() == previous_error_count;
+}
+
+bool YamlIOHandler::writeParametersToFile(const std::string& yaml_file_path, const ParameterInterface& parameter_interface)
+{
+  std::string yaml_output_string;
+  if (!writeParametersToString(parameter_interface, yaml_output_string))
+    return false;
+
+  // write the yaml stream to the file
+  std::ofstream output_file;
+  output_file.open(yaml_file_path);
+  output_file << yaml_output_string;
+  output_file.close();
+  return true;
+}
+
+/**
+ * @brief The EmitterVisitor class writes the parameter tree to a YAML emitter, each namespace as a nested map.
+ */
+class YamlIOHandler::EmitterVisitor : public ParameterIOBackend::TreeVisitor
+{
+public:
+  EmitterVisitor(YAML::Emitter& yaml_emitter, const ParameterInterface& parameter_interface) : yaml_emitter_(yaml_emitter), parameter_interface_(parameter_interface) {}
+
+  void beginNamespace(const std::string& key) override { yaml_emitter_ << YAML::Key << key << YAML::Value << YAML::BeginMap; }
+
+  void endNamespace() override { yaml_emitter_ << YAML::EndMap; }
+
+  void visitParameter(const std::string& key, const std::string& parameter_name) override
+  {
+    // add the parmeter name as key and declare that it is followed by its value
+    yaml_emitter_ << YAML::Key << key << YAML::Value;
+    appendParameterToYaml(yaml_emitter_, parameter_name, parameter_interface_);
+  }
+
+private:
+  YAML::Emitter& yaml_emitter_;
+  const ParameterInterface& parameter_interface_;
+};
 
-    setEmitterOptions(yaml);
+bool YamlIOHandler::writeParametersToString(const ParameterInterface& parameter_interface, std::string& yaml_output_string)
+{
+  return writeParametersToString(parameter_interface, yaml_output_string, 0);
+}
+
+bool YamlIOHandler::writeParametersToString(const ParameterInterface& parameter_interface, std::string& yaml_output_string, size_t thread_count)
+{
+  // partitions smaller than this are not worth the overhead of a thread
+  const size_t min_partition_size = 4096;
+
+  try
+  {
     std::vector<std::string> parameter_names = parameter_interface.getAllParameterNames();
-    std::string parameter_path;
-    std::vector<std::string> open_tokens;
-    yaml << YAML::BeginMap;
-    for (const auto& param_name : parameter_names)
+    thread_count = std::min(resolveThreadCount(thread_count), parameter_names.size() / min_partition_size);
+    if (thread_count <= 1)
+    {
+      yaml_output_string = emitParameters(parameter_interface, parameter_names);
+      return true;
+    }
+
+    // several partitions per thread balance namespaces of different size, the partitions are only cut between top-level namespaces
+    size_t target_partition_size = std::max(min_partition_size / 4, parameter_names.size() / (4 * thread_count));
+    std::vector<size_t> partition_begins = { 0 };
+    for (size_t i = 1; i < parameter_names.size(); i++)
+    {
+      if (i - partition_begins.back() >= target_partition_size && topLevelNamespace(parameter_names[i]) != topLevelNamespace(parameter_names[i - 1]))
+        partition_begins.push_back(i);
+    }
+    if (partition_begins.size() == 1)
+    {
+      yaml_output_string = emitParameters(parameter_interface, parameter_names);
+      return true;
+    }
+
+    std::vector<std::vector<std::string>> partitions(partition_begins.size());
+    for (size_t i = 0; i < partitions.size(); i++)
     {
-      std::vector<std::string> new_tokens;
-      // False positive by Clang Tidy: https://github.com/boostorg/algorithm/issues/63
-      // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-      boost::split(new_tokens, param_name, boost::is_any_of("/"));
-
-      // count the number of tokens that are consecutively equal in the prefixpath of the current structure allready
-      // written to the yaml and the new parameter
-      int nr_of_same_tokens = 0;
-      for (int i = 0; i < open_tokens.size() && i < new_tokens.size() - 1 &&  // new_tokens.size() - 1 as the last token is the name of the key
-                      new_tokens[i] == open_tokens[i];
-           i++)
+      auto begin = parameter_names.begin() + partition_begins[i];
+      auto end = i + 1 < partitions.size() ? parameter_names.begin() + partition_begins[i + 1] : parameter_names.end();
+      partitions[i].assign(std::make_move_iterator(begin), std::make_move_iterator(end));
+    }
+
+    std::vector<std::string> outputs(partitions.size());
+    std::atomic<bool> success{ true };
+    runInParallel(partitions.size(), thread_count, [&](size_t i) {
+      try
       {
-        nr_of_same_tokens = i + 1;
+        outputs[i] = emitParameters(parameter_interface, partitions[i]);
       }
-      // close all maps that are not part of the new parameter path
-      for (int i = nr_of_same_tokens; i < open_tokens.size(); i++)
+      catch (...)
       {
-        yaml << YAML::EndMap;
+        success = false;
       }
+    });
+    if (!success)
+      return false;
 
-      // open all new maps that are needed for the new parameter path
-      // as invariant it is expected, that there is allready an open map to insert the new name as key and the new map
-      // for the subdirectory as value
-      for (int i = nr_of_same_tokens; i < new_tokens.size() - 1; i++)
-      {
-        yaml << YAML::Key << new_tokens[i] << YAML::Value << YAML::BeginMap;
-      }
-      // add the parmeter name as key and declare that it is followed by its value
-      yaml << YAML::Key << new_tokens[new_tokens.size() - 1] << YAML::Value;
-      // remove the parameter name from the token vector and replace open tokens with the remaining path
-      new_tokens.pop_back();
-      open_tokens = new_tokens;
-
-      // figure out correct parameter type and apend it to the yaml stream
-      appendParameterToYaml(yaml, param_name, parameter_interface);
+    // the entries of a block map are separated by line breaks, the last entry has none
+    size_t output_size = outputs.size() - 1;
+    for (const auto& output : outputs)
+    {
+      output_size += output.size();
     }
-
-    // close all maps that are still open after the last parameter has been added
-    for (int i = 0; i < open_tokens.size(); i++)
+    yaml_output_string.clear();
+    yaml_output_string.reserve(output_size);
+    for (size_t i = 0; i < outputs.size(); i++)
     {
-      yaml << YAML::EndMap;
+      if (i > 0)
+        yaml_output_string.push_back('\n');
+      yaml_output_string += outputs[i];
     }
-    yaml << YAML::EndMap;
-
-    // write the yaml stream to the file
-    std::ofstream output_file;
-    output_file.open(yaml_file_path);
-    output_file << yaml.c_str();
-    output_file.close();
     return true;
   }
   catch (...)
@@ -131,74 +406,297 @@ bool YamlIOHandler::writeParametersToFile(const std::string& yaml_file_path, con
   }
 }
 
+std::string YamlIOHandler::emitParameters(const ParameterInterface& parameter_interface, const std::vector<std::string>& parameter_names)
+{
+  YAML::Emitter yaml;
+  setEmitterOptions(yaml);
+
+  EmitterVisitor visitor(yaml, parameter_interface);
+  yaml << YAML::BeginMap;
+  ParameterIOBackend::traverseParameterTree(parameter_names, visitor);
+  yaml << YAML::EndMap;
+  return yaml.c_str();
+}
+
 void YamlIOHandler::evaluateNode(const YAML::Node& node, const std::string& name_prefix, ParameterInterface& parameter_interface)
+{
+  std::string name = name_prefix;
+  addNodeParameters(node, name, parameter_interface);
+}
+
+void YamlIOHandler::addNodeParameters(const YAML::Node& node, std::string& name, ParameterInterface& parameter_interface)
 {
   if (node.IsMap())
   {
+    // the keys are appended to the name and removed again instead of concatenating a new name for every entry
+    size_t name_prefix_length = name.size();
     for (auto it = node.begin(); it != node.end(); it++)
     {
       auto node_pair = *it;
+      if (!node_pair.first.IsScalar())
+        throw std::invalid_argument("YAML key type is not supported. Name prefix: " + name.substr(0, name_prefix_length));
+      name.append(node_pair.first.Scalar());
 
-      if (node_pair.second.IsScalar())
-      {
-        readAndAddSingleParameter(name_prefix + node_pair.first.as<std::string>(), node_pair.second, parameter_interface);
-      }
-      else if (node_pair.second.IsSequence())
-      {
-        readAndAddParameterVector(name_prefix + node_pair.first.as<std::string>(), node_pair.second, parameter_interface);
-      }
-      else if (node_pair.second.IsMap())
+      if (node_pair.second.IsMap())
       {
-        evaluateNode(node_pair.second, name_prefix + node_pair.first.as<std::string>() + "/", parameter_interface);
+        name.push_back('/');
+        addNodeParameters(node_pair.second, name, parameter_interface);
       }
       else
       {
-        throw std::invalid_argument("YAML node type is not supported. Name prefix: " + name_prefix);
+        parameter_interface.setParam(name, convertValueNode(name, node_pair.second));
       }
+      name.resize(name_prefix_length);
     }
   }
 }
 
-void YamlIOHandler::readAndAddSingleParameter(const std::string& parameter_name, YAML::Node& value_node, ParameterInterface& parameter_interface)
+bool YamlIOHandler::readAndAddParametersDeferred(const std::vector<YAML::Node>& parameter_nodes, ParameterInterface& parameter_interface)
 {
-  if (addSingleParameterIfTypeCorrect<int>(parameter_name, value_node, parameter_interface))
+  // the parameters are committed at once, s.t. the interface stays unchanged if any node is not supported
+  RawParameterValue::Builder builder;
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  std::string name;
+  for (const auto& node : parameter_nodes)
   {
-    return;
+    addNodeParametersDeferred(node, name, transaction, builder);
   }
-  if (addSingleParameterIfTypeCorrect<double>(parameter_name, value_node, parameter_interface))
-  {
+  transaction.commit();
+  return true;
+}
+
+void YamlIOHandler::addNodeParametersDeferred(const YAML::Node& node, std::string& name, ParameterInterface::Transaction& transaction,
+                                              RawParameterValue::Builder& builder)
+{
+  if (!node.IsMap())
     return;
-  }
-  if (addSingleParameterIfTypeCorrect<bool>(parameter_name, value_node, parameter_interface))
+
+  size_t name_prefix_length = name.size();
+  for (auto it = node.begin(); it != node.end(); it++)
   {
-    return;
+    auto node_pair = *it;
+    if (!node_pair.first.IsScalar())
+      throw std::invalid_argument("YAML key type is not supported. Name prefix: " + name.substr(0, name_prefix_length));
+    name.append(node_pair.first.Scalar());
+
+    const YAML::Node& value_node = node_pair.second;
+    if (value_node.IsMap())
+    {
+      name.push_back('/');
+      addNodeParametersDeferred(value_node, name, transaction, builder);
+    }
+    else if (value_node.IsScalar())
+      transaction.setParam(name, builder.addScalar(value_node.Scalar()));
+    else if (value_node.IsSequence())
+    {
+      std::vector<std::string_view> elements;
+      elements.reserve(value_node.size());
+      for (auto element_it = value_node.begin(); element_it != value_node.end(); element_it++)
+      {
+        if (!element_it->IsScalar())
+          throw std::invalid_argument("Parameter sequence type of " + name + " is not supported.");
+        elements.push_back(element_it->Scalar());
+      }
+      transaction.setParam(name, builder.addSequence(elements));
+    }
+    else
+      throw std::invalid_argument("YAML node type is not supported. Parameter: " + name);
+    name.resize(name_prefix_length);
   }
-  if (addSingleParameterIfTypeCorrect<std::string>(parameter_name, value_node, parameter_interface))
-  {
+}
+
+void YamlIOHandler::evaluateNodeWithSchema(const YAML::Node& node, const std::string& name_prefix, ParameterInterface& parameter_interface,
+                                           const ParameterSchema& schema, std::vector<std::string>& errors)
+{
+  if (!node.IsMap())
     return;
+
+  for (auto it = node.begin(); it != node.end(); it++)
+  {
+    std::string parameter_name = name_prefix + it->first.as<std::string>();
+
+    // a declared parameter given as map is reported as type error by the conversion instead of being evaluated as namespace
+    const ParameterSchema::Entry* entry = schema.findEntry(parameter_name);
+    if (!entry && it->second.IsMap())
+    {
+      evaluateNodeWithSchema(it->second, parameter_name + "/", parameter_interface, schema, errors);
+      continue;
+    }
+
+    if (!entry)
+    {
+      // parameters that are not declared are added like without schema
+      try
+      {
+        parameter_interface.setParam(parameter_name, convertValueNode(parameter_name, it->second));
+      }
+      catch (const std::exception& e)
+      {
+        errors.push_back(e.what());
+      }
+      continue;
+    }
+
+    std::any value;
+    std::string error;
+    if (convertToDeclaredType(parameter_name, it->second, *entry, value, error) && ParameterSchema::validate(parameter_name, *entry, value, error))
+    {
+      parameter_interface.setParam(parameter_name, value);
+    }
+    else
+    {
+      errors.push_back(error);
+    }
   }
-  throw std::invalid_argument("Parameter type of " + parameter_name + " is not supported.");
 }
 
-void YamlIOHandler::readAndAddParameterVector(const std::string& parameter_name, YAML::Node& vector_node, ParameterInterface& parameter_interface)
+bool YamlIOHandler::readAndAddParametersWithSchema(const std::vector<YAML::Node>& parameter_nodes, ParameterInterface& parameter_interface,
+                                                   const ParameterSchema& schema, std::vector<std::string>& errors)
 {
-  if (addParameterVectorIfTypeCorrect<int>(parameter_name, vector_node, parameter_interface))
+  size_t previous_error_count = errors.size();
+
+  // the parameters are collected separately s.t. the interface stays unchanged if any error is found
+  ParameterInterface loaded_parameters;
+  for (const auto& node : parameter_nodes)
   {
-    return;
+    evaluateNodeWithSchema(node, "", loaded_parameters, schema, errors);
   }
-  if (addParameterVectorIfTypeCorrect<double>(parameter_name, vector_node, parameter_interface))
+
+  for (const auto& parameter_name : schema.getAllParameterNames())
   {
-    return;
+    if (loaded_parameters.hasParam(parameter_name) || parameter_interface.hasParam(parameter_name))
+      continue;
+
+    const ParameterSchema::Entry* entry = schema.findEntry(parameter_name);
+    if (entry->default_value.has_value())
+      loaded_parameters.setParam(parameter_name, entry->default_value);
+    else if (entry->required)
+      errors.push_back("Required parameter \"" + parameter_name + "\" is missing");
   }
-  if (addParameterVectorIfTypeCorrect<bool>(parameter_name, vector_node, parameter_interface))
-  {
+
+  if (errors.size() != previous_error_count)
+    return false;
+
+  parameter_interface.mergeParameters(std::move(loaded_parameters));
+  return true;
+}
+
+void YamlIOHandler::evaluateSchemaNode(const YAML::Node& node, const std::string& name_prefix, ParameterSchema& schema, std::vector<std::string>& errors)
+{
+  if (!node.IsMap())
     return;
+
+  for (auto it = node.begin(); it != node.end(); it++)
+  {
+    std::string parameter_name = name_prefix + it->first.as<std::string>();
+    const YAML::Node& declaration = it->second;
+
+    if (!declaration.IsMap())
+    {
+      errors.push_back("Schema declaration of \"" + parameter_name + "\" is not a map");
+      continue;
+    }
+    // maps without a type are namespaces containing further declarations
+    if (!declaration["type"] || !declaration["type"].IsScalar())
+    {
+      evaluateSchemaNode(declaration, parameter_name + "/", schema, errors);
+      continue;
+    }
+
+    ParameterSchema::Entry entry;
+    std::string error;
+    try
+    {
+      for (auto key_it = declaration.begin(); key_it != declaration.end(); key_it++)
+      {
+        std::string key = key_it->first.as<std::string>();
+        if (key == "type")
+        {
+          if (!ParameterSchema::typeFromString(key_it->second.as<std::string>(), entry.type))
+            error = "Unknown type \"" + key_it->second.as<std::string>() + "\" of parameter \"" + parameter_name + "\"";
+        }
+        else if (key == "required")
+          entry.required = key_it->second.as<bool>();
+        else if (key == "min")
+          entry.min = key_it->second.as<double>();
+        else if (key == "max")
+          entry.max = key_it->second.as<double>();
+        else if (key == "enum")
+          entry.enum_values = key_it->second.as<std::vector<std::string>>();
+        else if (key != "default")
+          error = "Unknown key \"" + key + "\" in schema declaration of \"" + parameter_name + "\"";
+      }
+    }
+    catch (const std::exception& e)
+    {
+      error = "Invalid schema declaration of \"" + parameter_name + "\": " + e.what();
+    }
+
+    // the default value can only be converted once the type is known
+    if (error.empty() && declaration["default"])
+      convertToDeclaredType(parameter_name, declaration["default"], entry, entry.default_value, error);
+
+    if (!error.empty() || !schema.addEntry(parameter_name, entry, error))
+      errors.push_back(error);
+  }
+}
+
+bool YamlIOHandler::convertToDeclaredType(const std::string& parameter_name, const YAML::Node& value_node, const ParameterSchema::Entry& entry, std::any& value,
+                                          std::string& error)
+{
+  bool converted = false;
+  switch (entry.type)
+  {
+    case ParameterSchema::Type::INT:
+      converted = value_node.IsScalar() && tryConvert<int>(value_node, value);
+      break;
+    case ParameterSchema::Type::DOUBLE:
+      converted = value_node.IsScalar() && tryConvert<double>(value_node, value);
+      break;
+    case ParameterSchema::Type::BOOL:
+      converted = value_node.IsScalar() && tryConvert<bool>(value_node, value);
+      break;
+    case ParameterSchema::Type::STRING:
+      converted = value_node.IsScalar() && tryConvert<std::string>(value_node, value);
+      break;
+    case ParameterSchema::Type::INT_VECTOR:
+      converted = value_node.IsSequence() && tryConvert<std::vector<int>>(value_node, value);
+      break;
+    case ParameterSchema::Type::DOUBLE_VECTOR:
+      converted = value_node.IsSequence() && tryConvert<std::vector<double>>(value_node, value);
+      break;
+    case ParameterSchema::Type::BOOL_VECTOR:
+      converted = value_node.IsSequence() && tryConvert<std::vector<bool>>(value_node, value);
+      break;
+    case ParameterSchema::Type::STRING_VECTOR:
+      converted = value_node.IsSequence() && tryConvert<std::vector<std::string>>(value_node, value);
+      break;
   }
-  if (addParameterVectorIfTypeCorrect<std::string>(parameter_name, vector_node, parameter_interface))
+
+  if (!converted)
+    error = "Parameter \"" + parameter_name + "\" can not be converted to type " + ParameterSchema::typeToString(entry.type);
+  return converted;
+}
+
+std::any YamlIOHandler::convertValueNode(const std::string& parameter_name, const YAML::Node& value_node)
+{
+  if (value_node.IsScalar())
+    return ParameterIOBackend::convertScalar(value_node.Scalar());
+
+  if (value_node.IsSequence())
   {
-    return;
+    std::vector<std::string_view> elements;
+    elements.reserve(value_node.size());
+    for (auto it = value_node.begin(); it != value_node.end(); it++)
+    {
+      if (!it->IsScalar())
+        throw std::invalid_argument("Parameter sequence type of " + parameter_name + " is not supported.");
+      elements.push_back(it->Scalar());
+    }
+    return ParameterIOBackend::convertSequence(elements);
   }
-  throw std::invalid_argument("Parameter sequence type of " + parameter_name + " is not supported.");
+
+  throw std::invalid_argument("YAML node type is not supported. Parameter: " + parameter_name);
 }
 
 void YamlIOHandler::setEmitterOptions(YAML::Emitter& yaml_emitter)
@@ -237,44 +735,15 @@ void YamlIOHandler::emitDouble(YAML::Emitter& yaml_emitter, double d)
 
 void YamlIOHandler::appendParameterToYaml(YAML::Emitter& yaml_emitter, const std::string& parameter_name, const ParameterInterface& parameter_interface)
 {
-  std::string value_as_string;
-  parameter_interface.getParam(parameter_name, value_as_string);
-  if (parameter_interface.hasParamOfType<int>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<int>(parameter_name);
-  }
-  else if (parameter_interface.hasParamOfType<double>(parameter_name))
-  {
-    emitDouble(yaml_emitter, parameter_interface.getParam<double>(parameter_name));
-  }
-  else if (parameter_interface.hasParamOfType<std::string>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<std::string>(parameter_name);
-  }
-  else if (parameter_interface.hasParamOfType<bool>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<bool>(parameter_name);
-  }
-  else if (parameter_interface.hasParamOfType<std::vector<int>>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<std::vector<int>>(parameter_name);
-  }
-  else if (parameter_interface.hasParamOfType<std::vector<double>>(parameter_name))
-  {
-    emitDoubleVec(yaml_emitter, parameter_interface.getParam<std::vector<double>>(parameter_name));
-  }
-  else if (parameter_interface.hasParamOfType<std::vector<bool>>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<std::vector<bool>>(parameter_name);
-  }
-  else if (parameter_interface.hasParamOfType<std::vector<std::string>>(parameter_name))
-  {
-    yaml_emitter << parameter_interface.getParam<std::vector<std::string>>(parameter_name);
-  }
-  else
-  {
-    throw std::invalid_argument("Parameter \"" + parameter_name + " was not found");
-  }
+  ParameterIOBackend::visitParameterValue(parameter_interface, parameter_name, [&yaml_emitter](const auto& value) {
+    using ValueType = std::decay_t<decltype(value)>;
+    if constexpr (std::is_same_v<ValueType, double>)
+      emitDouble(yaml_emitter, value);
+    else if constexpr (std::is_same_v<ValueType, std::vector<double>>)
+      emitDoubleVec(yaml_emitter, value);
+    else
+      yaml_emitter << value;
+  });
 }
 
 template <typename T>
@@ -292,41 +761,58 @@ bool YamlIOHandler::tryParse(YAML::Node node, T& val)
 }
 
 template <typename T>
-bool YamlIOHandler::addSingleParameterIfTypeCorrect(const std::string& parameter_name, YAML::Node& value_node, ParameterInterface& parameter_interface)
-{
-  T value_of_type_t;
-  if (tryParse(value_node, value_of_type_t))
-  {
-    parameter_interface.setParam(parameter_name, value_of_type_t);
-    return true;
-  }
-  return false;
-}
-
-template <typename T>
-bool YamlIOHandler::addParameterVectorIfTypeCorrect(const std::string& parameter_name, YAML::Node& vector_node, ParameterInterface& parameter_interface)
+bool YamlIOHandler::tryParseSequence(const YAML::Node& sequence_node, std::vector<T>& values)
 {
-  std::vector<T> new_parameter_vector(vector_node.size());
+  values.resize(sequence_node.size());
 
-  bool parsing_succefull = true;
   uint element_count = 0;
-
-  for (auto it = vector_node.begin(); it != vector_node.end(); it++)
+  for (auto it = sequence_node.begin(); it != sequence_node.end(); it++)
   {
     T vector_element;
-    parsing_succefull = tryParse(*it, vector_element);
-    if (parsing_succefull)
-    {
-      new_parameter_vector[element_count] = vector_element;
-      element_count++;
-    }
-    else
+    if (!tryParse(*it, vector_element))
     {
       return false;
     }
+    values[element_count] = vector_element;
+    element_count++;
   }
-
-  parameter_interface.setParam(parameter_name, new_parameter_vector);
   return true;
 }
+
+template <typename T>
+bool YamlIOHandler::tryConvert(const YAML::Node& node, std::any& value)
+{
+  T value_of_type_t;
+  bool parsing_succesful;
+  if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<double>> || std::is_same_v<T, std::vector<bool>> ||
+                std::is_same_v<T, std::vector<std::string>>)
+    parsing_succesful = tryParseSequence(node, value_of_type_t);
+  else
+    parsing_succesful = tryParse(node, value_of_type_t);
+
+  if (parsing_succesful)
+    value = value_of_type_t;
+  return parsing_succesful;
+}
+
+bool YamlIOBackend::readAndAddParametersFromFile(const std::string& file_path, ParameterInterface& parameter_interface) const
+{
+  return YamlIOHandler::readAndAddParametersFromFile(file_path, parameter_interface, conversion_);
+}
+
+bool YamlIOBackend::readAndAddParametersFromString(const std::string& input_string, ParameterInterface& parameter_interface) const
+{
+  return YamlIOHandler::readAndAddParametersFromString(input_string, parameter_interface, conversion_);
+}
+
+bool YamlIOBackend::writeParametersToFile(const std::string& file_path, const ParameterInterface& parameter_interface) const
+{
+  return YamlIOHandler::writeParametersToFile(file_path, parameter_interface);
+}
+
+bool YamlIOBackend::writeParametersToString(const ParameterInterface& parameter_interface, std::string& output_string) const
+{
+  return YamlIOHandler::writeParametersToString(parameter_interface, output_string);
+}
 }  // namespace paraminf
+
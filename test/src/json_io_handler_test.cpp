@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "paraminf/json_io_handler.h"
+#include "paraminf/parameter_codec.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+void expectEqualParameters(const ParameterInterface& expected, const ParameterInterface& actual)
+{
+  ASSERT_EQ(actual.getAllParameterNames(), expected.getAllParameterNames());
+  for (const auto& parameter_name : expected.getAllParameterNames())
+  {
+    std::string expected_value;
+    std::string actual_value;
+    ParameterCodec::encodeParameter(expected, parameter_name, expected_value);
+    ParameterCodec::encodeParameter(actual, parameter_name, actual_value);
+    EXPECT_EQ(actual_value, expected_value) << "Parameter \"" << parameter_name << "\" differs in type or value";
+  }
+}
+
+TEST(JsonIOTest, ReadFileMatchesYamlTest)
+{
+  ParameterInterface yaml_parameters;
+  ParameterInterface json_parameters;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", yaml_parameters));
+  ASSERT_TRUE(JsonIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.json", json_parameters));
+  EXPECT_TRUE(json_parameters.hasBeenUpdated());
+
+  expectEqualParameters(yaml_parameters, json_parameters);
+  EXPECT_FALSE(JsonIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/not_there.json", json_parameters));
+}
+
+TEST(JsonIOTest, ReadStringTest)
+{
+  ParameterInterface parameter_interface;
+  ASSERT_TRUE(JsonIOHandler::readAndAddParametersFromString(R"({"a": {"escaped": "line\nbreak \"quoted\" ä😀", "quoted_int": "12",
+    "exponent": 1e3, "big": 3000000000, "empty": [], "escaped_vector": ["x\ty", "z"], "nested": {}}})",
+                                                            parameter_interface));
+  EXPECT_EQ(parameter_interface.getParam<std::string>("a/escaped"), "line\nbreak \"quoted\" \xC3\xA4\xF0\x9F\x98\x80");
+  EXPECT_TRUE(parameter_interface.hasParamOfType<int>("a/quoted_int")) << "Quoted numbers are converted like in YAML";
+  EXPECT_EQ(parameter_interface.getParam<double>("a/exponent"), 1000.0);
+  EXPECT_FALSE(parameter_interface.hasParamOfType<int>("a/exponent"));
+  EXPECT_EQ(parameter_interface.getParam<double>("a/big"), 3000000000.0);
+  EXPECT_EQ(parameter_interface.getParam<std::vector<int>>("a/empty"), std::vector<int>{});
+  EXPECT_EQ(parameter_interface.getParam<std::vector<std::string>>("a/escaped_vector"), (std::vector<std::string>{ "x\ty", "z" }));
+  EXPECT_EQ(parameter_interface.getAllParameterNames().size(), 6);
+
+  // documents that are not an object contain no parameters
+  EXPECT_TRUE(JsonIOHandler::readAndAddParametersFromString("[1, 2]", parameter_interface));
+  EXPECT_EQ(parameter_interface.getAllParameterNames().size(), 6);
+}
+
+TEST(JsonIOTest, InvalidInputTest)
+{
+  std::vector<std::string> invalid_inputs = { R"({"a": 1,})",       R"({"a": 01})",        R"({"a" 1})",          R"({"a": [1, [2]]})",  R"({"a": null})",
+                                              R"({"a": [null]})",   R"({"a": "unterminated})", R"({"a": "\x"})", R"({"a": 1} {"b": 2})", R"({"a": tru})",
+                                              std::string(1000, '{') };
+  for (const auto& input : invalid_inputs)
+  {
+    ParameterInterface parameter_interface;
+    EXPECT_FALSE(JsonIOHandler::readAndAddParametersFromString(input, parameter_interface)) << "Invalid input " << input.substr(0, 30) << " was accepted";
+  }
+
+  // no parameters are added if the input is invalid
+  ParameterInterface parameter_interface;
+  EXPECT_FALSE(JsonIOHandler::readAndAddParametersFromString(R"({"a": 1, "b": [1, [2]]})", parameter_interface));
+  EXPECT_FALSE(parameter_interface.hasParam("a"));
+}
+
+TEST(JsonIOTest, WriteAndReadBackTest)
+{
+  ParameterInterface parameter_interface;
+  YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", parameter_interface);
+  parameter_interface.setParam("special/infinity", std::numeric_limits<double>::infinity());
+  parameter_interface.setParam("special/escaped", std::string("a \"b\"\n"));
+  parameter_interface.setParam("special/whole_double", 3.0);
+
+  std::string json_output;
+  ASSERT_TRUE(JsonIOHandler::writeParametersToString(parameter_interface, json_output));
+  EXPECT_NE(json_output.find("\"whole_double\": 3.0"), std::string::npos) << "Whole doubles must be written with decimal";
+
+  ParameterInterface read_parameters;
+  ASSERT_TRUE(JsonIOHandler::readAndAddParametersFromString(json_output, read_parameters)) << json_output;
+  expectEqualParameters(parameter_interface, read_parameters);
+
+  // the JSON output can be read as YAML as well
+  ParameterInterface yaml_parameters;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(json_output, yaml_parameters));
+  expectEqualParameters(parameter_interface, yaml_parameters);
+
+  std::string empty_output;
+  ASSERT_TRUE(JsonIOHandler::writeParametersToString(ParameterInterface(), empty_output));
+  EXPECT_EQ(empty_output, "{}\n");
+}
+
+}  // namespace test
+}  // namespace paraminf
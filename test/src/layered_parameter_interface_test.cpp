@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "paraminf/layered_parameter_interface.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(LayeredParameterInterfaceTest, ResolveTopDownTest)
+{
+  ParameterInterface::Ptr defaults = std::make_shared<ParameterInterface>();
+  defaults->setParam("controller/gain", 1.0);
+  defaults->setParam("controller/rate", 100);
+  defaults->setParam("frame", std::string("base_link"));
+
+  ParameterInterface::Ptr robot = std::make_shared<ParameterInterface>();
+  robot->setParam("controller/gain", 2.5);
+
+  LayeredParameterInterface layered({ defaults, robot });
+
+  EXPECT_EQ(layered.getLayerCount(), 2);
+  EXPECT_EQ(layered.getParam<double>("controller/gain"), 2.5) << "Upper layer did not shadow the lower layer";
+  EXPECT_EQ(layered.getParam<int>("controller/rate"), 100) << "Parameter of the lower layer was not resolved";
+  EXPECT_EQ(layered.getParam<double>("controller/rate"), 100.0) << "Int parameter was not converted to double";
+  EXPECT_EQ(layered.getParam<std::string>("frame"), "base_link") << "Parameter of the lower layer was not resolved";
+  EXPECT_TRUE(layered.hasParamOfType<double>("controller/gain"));
+  EXPECT_FALSE(layered.hasParam("not_there"));
+  EXPECT_ANY_THROW(layered.getParam<int>("not_there"));
+
+  std::vector<std::string> expected_names = { "controller/gain", "controller/rate", "frame" };
+  EXPECT_EQ(layered.getAllParameterNames(), expected_names);
+
+  ParameterInterface flattened = layered.flatten();
+  EXPECT_EQ(flattened.getAllParameterNames(), expected_names);
+  EXPECT_EQ(flattened.getParam<double>("controller/gain"), 2.5) << "Flattening did not keep the value of the upper layer";
+}
+
+TEST(LayeredParameterInterfaceTest, LayerChangeInvalidatesResolutionTest)
+{
+  ParameterInterface::Ptr defaults = std::make_shared<ParameterInterface>();
+  defaults->setParam("gain", 1.0);
+  ParameterInterface::Ptr site = std::make_shared<ParameterInterface>();
+  ParameterInterface::Ptr robot = std::make_shared<ParameterInterface>();
+
+  LayeredParameterInterface layered({ defaults, site });
+  layered.pushLayer(robot);
+
+  // resolve once to fill the cache, including a negative lookup
+  EXPECT_EQ(layered.getParam<double>("gain"), 1.0);
+  EXPECT_FALSE(layered.hasParam("offset"));
+
+  site->setParam("gain", 2.0);
+  site->setParam("offset", 0.5);
+  EXPECT_EQ(layered.getParam<double>("gain"), 2.0) << "Change of a middle layer was not detected";
+  EXPECT_EQ(layered.getParam<double>("offset"), 0.5) << "Cached negative lookup was not invalidated";
+
+  // a change of the bottom layer must not affect parameters shadowed by upper layers
+  defaults->setParam("gain", 3.0);
+  EXPECT_EQ(layered.getParam<double>("gain"), 2.0);
+
+  robot->setParam("gain", 4.0);
+  EXPECT_EQ(layered.getParam<double>("gain"), 4.0) << "Change of the top layer was not detected";
+
+  robot->removeParam("gain");
+  site->removeParam("gain");
+  EXPECT_EQ(layered.getParam<double>("gain"), 3.0) << "Removal in upper layers was not detected";
+
+  // a parameter of another type still shadows the lower layers
+  robot->setParam("gain", std::string("high"));
+  double gain;
+  EXPECT_FALSE(layered.getParam("gain", gain));
+  EXPECT_FALSE(layered.hasParamOfType<double>("gain"));
+  EXPECT_TRUE(layered.hasParamOfType<std::string>("gain"));
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "paraminf/parameter_checkpointer.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(ParameterCheckpointerTest, WriteCheckpointTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("controller/gain", 2.5);
+  parameter_interface->setParam("controller/rate", 100);
+
+  ParameterCheckpointer checkpointer(parameter_interface, "CheckpointTestOut.yaml", std::chrono::milliseconds(0));
+  ASSERT_TRUE(checkpointer.requestCheckpoint().get());
+  EXPECT_EQ(checkpointer.getWriteCount(), 1);
+
+  ParameterInterface reread;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile("CheckpointTestOut.yaml", reread));
+  EXPECT_EQ(reread.getParam<double>("controller/gain"), 2.5);
+  EXPECT_EQ(reread.getParam<int>("controller/rate"), 100);
+
+  // unchanged parameters are not written again
+  ASSERT_TRUE(checkpointer.requestCheckpoint().get());
+  EXPECT_EQ(checkpointer.getWriteCount(), 1) << "Unchanged parameters were written again";
+
+  parameter_interface->setParam("controller/gain", 3.0);
+  ASSERT_TRUE(checkpointer.requestCheckpoint().get());
+  EXPECT_EQ(checkpointer.getWriteCount(), 2) << "Changed parameters were not written";
+
+  ParameterInterface reread_changed;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile("CheckpointTestOut.yaml", reread_changed));
+  EXPECT_EQ(reread_changed.getParam<double>("controller/gain"), 3.0);
+}
+
+TEST(ParameterCheckpointerTest, RateLimitAndCoalesceTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("counter", 0);
+
+  std::shared_future<bool> last_checkpoint;
+  {
+    ParameterCheckpointer checkpointer(parameter_interface, "CheckpointRateLimitTestOut.yaml", std::chrono::hours(1));
+    ASSERT_TRUE(checkpointer.requestCheckpoint().get());
+
+    // requests within the write interval are coalesced into one pending checkpoint
+    for (int i = 1; i <= 10; i++)
+    {
+      parameter_interface->setParam("counter", i);
+      last_checkpoint = checkpointer.requestCheckpoint();
+    }
+    EXPECT_EQ(last_checkpoint.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout) << "Write interval was not respected";
+    EXPECT_EQ(checkpointer.getWriteCount(), 1);
+  }
+  // the pending checkpoint is written when the checkpointer is destroyed
+  ASSERT_TRUE(last_checkpoint.get());
+
+  ParameterInterface reread;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile("CheckpointRateLimitTestOut.yaml", reread));
+  EXPECT_EQ(reread.getParam<int>("counter"), 10);
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "paraminf/parameter_codec.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(ParameterCodecTest, EncodeAndDecodeTest)
+{
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("int", -7);
+  parameter_interface.setParam("double", 0.4);
+  parameter_interface.setParam("bool", true);
+  parameter_interface.setParam("string", std::string("apple"));
+  parameter_interface.setParam("int_vec", std::vector<int>{ 3, 2, 1 });
+  parameter_interface.setParam("double_vec", std::vector<double>{ 1.3, 4.2 });
+  parameter_interface.setParam("bool_vec", std::vector<bool>{ true, false, true });
+  parameter_interface.setParam("string_vec", std::vector<std::string>{ "apple", "", "banana" });
+
+  std::string buffer;
+  for (const auto& parameter_name : parameter_interface.getAllParameterNames())
+  {
+    ASSERT_TRUE(ParameterCodec::encodeParameter(parameter_interface, parameter_name, buffer)) << "Parameter \"" << parameter_name << "\" was not encoded";
+  }
+
+  size_t offset = 0;
+  ParameterInterface decoded;
+  for (const auto& parameter_name : parameter_interface.getAllParameterNames())
+  {
+    std::any value;
+    ASSERT_TRUE(ParameterCodec::decodeValue(buffer.data(), buffer.size(), offset, value)) << "Parameter \"" << parameter_name << "\" was not decoded";
+    decoded.setParam(parameter_name, value);
+  }
+  EXPECT_EQ(offset, buffer.size());
+
+  EXPECT_EQ(decoded.getParam<int>("int"), -7);
+  EXPECT_EQ(decoded.getParam<double>("double"), 0.4);
+  EXPECT_EQ(decoded.getParam<bool>("bool"), true);
+  EXPECT_EQ(decoded.getParam<std::string>("string"), "apple");
+  EXPECT_EQ(decoded.getParam<std::vector<int>>("int_vec"), (std::vector<int>{ 3, 2, 1 }));
+  EXPECT_EQ(decoded.getParam<std::vector<double>>("double_vec"), (std::vector<double>{ 1.3, 4.2 }));
+  EXPECT_EQ(decoded.getParam<std::vector<bool>>("bool_vec"), (std::vector<bool>{ true, false, true }));
+  EXPECT_EQ(decoded.getParam<std::vector<std::string>>("string_vec"), (std::vector<std::string>{ "apple", "", "banana" }));
+}
+
+TEST(ParameterCodecTest, MalformedDataTest)
+{
+  std::string buffer;
+  ParameterCodec::encode(std::vector<std::string>{ "apple", "banana" }, buffer);
+
+  // every truncation of the data has to be detected
+  for (size_t size = 0; size < buffer.size(); size++)
+  {
+    size_t offset = 0;
+    std::any value;
+    EXPECT_FALSE(ParameterCodec::decodeValue(buffer.data(), size, offset, value)) << "Truncation to " << size << " bytes was not detected";
+  }
+
+  std::string unknown_type(1, static_cast<char>(0));
+  size_t offset = 0;
+  std::any value;
+  EXPECT_FALSE(ParameterCodec::decodeValue(unknown_type.data(), unknown_type.size(), offset, value));
+
+  std::string unsupported;
+  EXPECT_FALSE(ParameterCodec::encodeValue(std::any(1.0f), unsupported));
+}
+
+}  // namespace test
+}  // namespace paraminf
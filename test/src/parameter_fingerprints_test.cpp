@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "paraminf/parameter_interface.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(ParameterFingerprintsTest, NamespaceFingerprintTest)
+{
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("robot_1/arm/gain", 2.5);
+  parameter_interface.setParam("robot_1/arm/joints", std::vector<std::string>{ "shoulder", "elbow" });
+  parameter_interface.setParam("robot_1/base/rate", 100);
+  parameter_interface.setParam("robot_2/arm/joints", std::vector<std::string>{ "shoulder", "elbow" });
+  parameter_interface.setParam("robot_2/arm/gain", 2.5);
+  parameter_interface.setParam("robot_2/base/rate", 100);
+
+  uint64_t root_fingerprint = parameter_interface.getFingerprint();
+  EXPECT_NE(root_fingerprint, 0);
+  EXPECT_EQ(parameter_interface.getFingerprint("robot_1"), parameter_interface.getFingerprint("robot_2/")) << "Equal subtrees have different fingerprints";
+  EXPECT_NE(parameter_interface.getFingerprint("robot_1/arm"), parameter_interface.getFingerprint("robot_1/base"));
+  EXPECT_EQ(parameter_interface.getFingerprint("robot_3"), 0);
+
+  // changes only affect the namespaces on the path of the parameter
+  uint64_t base_fingerprint = parameter_interface.getFingerprint("robot_1/base");
+  parameter_interface.setParam("robot_1/arm/gain", 3.0);
+  EXPECT_NE(parameter_interface.getFingerprint("robot_1"), parameter_interface.getFingerprint("robot_2"));
+  EXPECT_NE(parameter_interface.getFingerprint(), root_fingerprint);
+  EXPECT_EQ(parameter_interface.getFingerprint("robot_1/base"), base_fingerprint);
+
+  parameter_interface.setParam("robot_1/arm/gain", 2.5);
+  EXPECT_EQ(parameter_interface.getFingerprint(), root_fingerprint) << "Reverting a change did not restore the fingerprint";
+
+  // the type is part of the fingerprint
+  parameter_interface.setParam("robot_1/base/rate", 100.0);
+  EXPECT_NE(parameter_interface.getFingerprint("robot_1"), parameter_interface.getFingerprint("robot_2"));
+
+  parameter_interface.removeParam("robot_1/base/rate");
+  parameter_interface.removeParam("robot_2/base/rate");
+  EXPECT_EQ(parameter_interface.getFingerprint("robot_1/base"), 0);
+  EXPECT_EQ(parameter_interface.getFingerprint("robot_1"), parameter_interface.getFingerprint("robot_2"));
+}
+
+TEST(ParameterFingerprintsTest, IndependentOfHistoryTest)
+{
+  ParameterInterface loaded;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", loaded));
+  std::vector<std::string> names = loaded.getAllParameterNames();
+
+  // the same parameters added in a different order, to another pool and with intermediate values
+  ParameterInterface rebuilt;
+  rebuilt.setParam("unrelated/parameter", 1);
+  EXPECT_NE(rebuilt.getFingerprint(), 0);
+  std::shuffle(names.begin(), names.end(), std::mt19937(42));
+  for (const auto& name : names)
+  {
+    rebuilt.setParam(name, 0);
+  }
+  ParameterInterface::Transaction transaction = rebuilt.beginTransaction();
+  transaction.removeParam("unrelated/parameter");
+  transaction.commit();
+  rebuilt.mergeParameters(loaded);
+
+  EXPECT_EQ(rebuilt.getFingerprint(), loaded.getFingerprint());
+  for (const auto& name : names)
+  {
+    std::string name_space = name.substr(0, name.rfind('/') == std::string::npos ? 0 : name.rfind('/'));
+    EXPECT_EQ(rebuilt.getFingerprint(name_space), loaded.getFingerprint(name_space)) << name_space;
+  }
+
+  ParameterInterface copy = rebuilt;
+  EXPECT_EQ(copy.getFingerprint(), loaded.getFingerprint());
+  ParameterInterface moved_into;
+  moved_into.getFingerprint();
+  moved_into.mergeParameters(std::move(copy));
+  EXPECT_EQ(moved_into.getFingerprint(), loaded.getFingerprint());
+  EXPECT_EQ(copy.getFingerprint(), 0);
+}
+
+}  // namespace test
+}  // namespace paraminf
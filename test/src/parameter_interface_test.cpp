@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <memory_resource>
 #include <vector>
 
 #include <eigen3/Eigen/Core>
@@ -11,6 +12,28 @@ namespace paraminf
 {
 namespace test
 {
+// counts the bytes currently allocated from the global heap through the resource
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+  size_t allocated_bytes = 0;
+
+private:
+  void* do_allocate(size_t bytes, size_t alignment) override
+  {
+    allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+  {
+    allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
 template <typename T>
 void testSingleParameter(const std::string& parameter_name, T expected_result, ParameterInterface& parameter_interface, const std::string& error_message = "")
 {
@@ -192,5 +215,145 @@ TEST(ParameterInterfaceTest, HasParamTest)
                                                                                             "found";
 }
 
+TEST(ParameterInterfaceTest, TransactionCommitTest)
+{
+  ParameterInterface parameter_interface;
+
+  parameter_interface.setParam("test_int", 42);
+  parameter_interface.setParam("test_removed", 1.0);
+  parameter_interface.resetUpdateFlag();
+
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  transaction.setParam("test_int", 7);
+  transaction.setParam("test_string", std::string("apple"));
+  transaction.removeParam("test_removed");
+  transaction.setParam("test_discarded", true);
+  transaction.removeParam("test_discarded");
+
+  // nothing is visible before the commit
+  EXPECT_FALSE(parameter_interface.hasBeenUpdated());
+  EXPECT_EQ(parameter_interface.getParam<int>("test_int"), 42) << "Staged value was visible before commit";
+  EXPECT_FALSE(parameter_interface.hasParam("test_string")) << "Staged parameter was visible before commit";
+  EXPECT_TRUE(parameter_interface.hasParam("test_removed")) << "Staged removal was visible before commit";
+
+  transaction.commit();
+
+  EXPECT_TRUE(parameter_interface.hasBeenUpdated());
+  EXPECT_TRUE(transaction.empty());
+  EXPECT_EQ(parameter_interface.getParam<int>("test_int"), 7) << "Existing parameter was not overwritten by commit";
+  EXPECT_EQ(parameter_interface.getParam<std::string>("test_string"), "apple") << "New parameter was not added by commit";
+  EXPECT_FALSE(parameter_interface.hasParam("test_removed")) << "Parameter was not removed by commit";
+  EXPECT_FALSE(parameter_interface.hasParam("test_discarded")) << "Parameter removed within the transaction was added";
+
+  // an empty commit does not flag an update
+  parameter_interface.resetUpdateFlag();
+  transaction.commit();
+  EXPECT_FALSE(parameter_interface.hasBeenUpdated());
+
+  // neither does a commit that only removes parameters that do not exist
+  uint64_t version = parameter_interface.getVersion();
+  transaction.removeParam("test_unknown");
+  transaction.commit();
+  EXPECT_FALSE(parameter_interface.hasBeenUpdated());
+  EXPECT_EQ(parameter_interface.getVersion(), version);
+}
+
+TEST(ParameterInterfaceTest, TransactionDiscardTest)
+{
+  ParameterInterface parameter_interface;
+
+  {
+    ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+    transaction.setParam("test_int", 42);
+  }
+  EXPECT_FALSE(parameter_interface.hasParam("test_int")) << "Uncommitted transaction was published";
+
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  transaction.setParam("test_int", 42);
+  transaction.discard();
+  transaction.commit();
+  EXPECT_FALSE(parameter_interface.hasParam("test_int")) << "Discarded transaction was published";
+  EXPECT_FALSE(parameter_interface.hasBeenUpdated());
+
+  parameter_interface.setParam("test_int", 42);
+  EXPECT_TRUE(parameter_interface.removeParam("test_int"));
+  EXPECT_FALSE(parameter_interface.removeParam("test_int"));
+  EXPECT_FALSE(parameter_interface.hasParam("test_int"));
+}
+
+TEST(ParameterInterfaceTest, MemoryResourceTest)
+{
+  auto memory_resource = std::make_shared<CountingMemoryResource>();
+  {
+    ParameterInterface parameter_interface(std::make_shared<StringPool>(memory_resource), memory_resource);
+    EXPECT_EQ(parameter_interface.getMemoryResource(), memory_resource);
+
+    parameter_interface.setParam("robot/frame", std::string("base_link"));
+    ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+    transaction.setParam("robot/gain", 2.0);
+    transaction.commit();
+    size_t allocated_bytes = memory_resource->allocated_bytes;
+    EXPECT_GT(allocated_bytes, 0) << "Map nodes and strings were not allocated from the memory resource";
+
+    // copies share the resource, merging interfaces with different resources copies the entries
+    ParameterInterface copy(parameter_interface);
+    EXPECT_EQ(copy.getMemoryResource(), memory_resource);
+    EXPECT_GT(memory_resource->allocated_bytes, allocated_bytes);
+
+    ParameterInterface other(parameter_interface.getStringPool());
+    other.setParam("robot/id", 7);
+    parameter_interface.mergeParameters(std::move(other));
+    EXPECT_EQ(parameter_interface.getParam<int>("robot/id"), 7);
+    EXPECT_EQ(parameter_interface.getParam<double>("robot/gain"), 2.0);
+    EXPECT_EQ(parameter_interface.getParam<std::string>("robot/frame"), "base_link");
+    EXPECT_FALSE(other.hasParam("robot/id"));
+
+    copy = other;
+    EXPECT_EQ(copy.getMemoryResource(), memory_resource) << "Assignment must not change the memory resource";
+
+    // the strings of an interface with another pool are interned in the pool of the assigned interface
+    ParameterInterface foreign;
+    foreign.setParam("robot/frame", std::string("tool"));
+    copy = foreign;
+    EXPECT_EQ(copy.getStringPool(), parameter_interface.getStringPool()) << "Assignment must not change the string pool";
+    EXPECT_EQ(copy.getParam<std::string>("robot/frame"), "tool");
+  }
+  EXPECT_EQ(memory_resource->allocated_bytes, 0) << "Memory allocated from the resource was not released";
+  EXPECT_THROW(ParameterInterface(std::make_shared<StringPool>(), nullptr), std::invalid_argument);
+}
+
+TEST(ParameterInterfaceTest, PartitionsTest)
+{
+  EXPECT_EQ(ParameterInterface::getPartitionNamespace("robot/arm/gain", 1), "robot");
+  EXPECT_EQ(ParameterInterface::getPartitionNamespace("robot/arm/gain", 2), "robot/arm");
+  EXPECT_EQ(ParameterInterface::getPartitionNamespace("robot/arm/gain", 3), "robot/arm");
+  EXPECT_EQ(ParameterInterface::getPartitionNamespace("robot/rate", 2), "robot");
+  EXPECT_EQ(ParameterInterface::getPartitionNamespace("rate", 1), "");
+
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("rate", 10);
+  parameter_interface.setParam("robot/rate", 20);
+  parameter_interface.setParam("robot/arm/gain", 1.5);
+  parameter_interface.setParam("robot/arm/name", std::string("arm"));
+  parameter_interface.setParam("robot/arm_2/gain", 2.5);
+  parameter_interface.setParam("robot-2/rate", 30);
+
+  std::map<std::string, ParameterInterface, std::less<>> partitions = parameter_interface.getPartitions(2);
+  ASSERT_EQ(partitions.size(), 5);
+  EXPECT_EQ(partitions.at("").getAllParameterNames(), std::vector<std::string>{ "rate" });
+  EXPECT_EQ(partitions.at("robot").getAllParameterNames(), std::vector<std::string>{ "robot/rate" });
+  EXPECT_EQ(partitions.at("robot/arm").getAllParameterNames(), (std::vector<std::string>{ "robot/arm/gain", "robot/arm/name" }));
+  EXPECT_EQ(partitions.at("robot/arm").getParam<std::string>("robot/arm/name"), "arm");
+  EXPECT_EQ(partitions.at("robot/arm").getStringPool(), parameter_interface.getStringPool());
+
+  // selected partitions skip the names of nested partitions
+  std::set<std::string, std::less<>> selected_partitions = { "", "robot", "robot/arm_2", "robot/arm/gain", "unknown" };
+  partitions = parameter_interface.getPartitions(2, &selected_partitions);
+  ASSERT_EQ(partitions.size(), 3);
+  EXPECT_EQ(partitions.at("").getAllParameterNames(), std::vector<std::string>{ "rate" });
+  EXPECT_EQ(partitions.at("robot").getAllParameterNames(), std::vector<std::string>{ "robot/rate" });
+  EXPECT_EQ(partitions.at("robot/arm_2").getAllParameterNames(), std::vector<std::string>{ "robot/arm_2/gain" });
+}
+
 }  // namespace test
 }  // namespace paraminf
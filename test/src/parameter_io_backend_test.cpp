@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <yaml-cpp/yaml.h>
+
+#include "paraminf/json_io_handler.h"
+#include "paraminf/parameter_io_backend.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+template <typename T>
+bool convertWithYamlCpp(const std::string& text, T& value)
+{
+  try
+  {
+    value = YAML::Node(text).as<T>();
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+class RecordingVisitor : public ParameterIOBackend::TreeVisitor
+{
+public:
+  void beginNamespace(const std::string& key) override { events.push_back("begin " + key); }
+  void endNamespace() override { events.push_back("end"); }
+  void visitParameter(const std::string& key, const std::string& parameter_name) override { events.push_back(key + "=" + parameter_name); }
+
+  std::vector<std::string> events;
+};
+
+TEST(ParameterIOBackendTest, ScalarConversionMatchesYamlCppTest)
+{
+  std::vector<std::string> texts = { "0",     "-7",    "+7",      "017",    "08",      "0x1F",        "-0x10",       "0x",          "2147483647", "-2147483648",
+                                     "2147483648", "7 ", " 7",   "1.5",    "-.5",     "1.",          ".",           "1e5",         "1E-3",       "1e",
+                                     "+1.5",  "1e400", "inf",     "nan",    ".inf",    "-.Inf",       "+.INF",       ".NaN",        ".nAn",       "true",
+                                     "False", "YES",   "yEs",     "on",     "Off",     "y",           "N",           "truex",       "",           "-",
+                                     "abc",   "123x",  "1_000",   "0x1p3",  "1.5.5",   "- 1" };
+  for (const auto& text : texts)
+  {
+    int expected_int = 0;
+    int converted_int = 0;
+    bool is_int = convertWithYamlCpp(text, expected_int);
+    EXPECT_EQ(ParameterIOBackend::parseInt(text, converted_int), is_int) << "Int conversion of \"" << text << "\" differs from yaml-cpp";
+    if (is_int)
+    {
+      EXPECT_EQ(converted_int, expected_int) << "Int value of \"" << text << "\" differs from yaml-cpp";
+    }
+
+    double expected_double = 0.0;
+    double converted_double = 0.0;
+    bool is_double = convertWithYamlCpp(text, expected_double);
+    EXPECT_EQ(ParameterIOBackend::parseDouble(text, converted_double), is_double) << "Double conversion of \"" << text << "\" differs from yaml-cpp";
+    if (is_double && !std::isnan(expected_double))
+    {
+      EXPECT_EQ(converted_double, expected_double) << "Double value of \"" << text << "\" differs from yaml-cpp";
+    }
+
+    bool expected_bool = false;
+    bool converted_bool = false;
+    bool is_bool = convertWithYamlCpp(text, expected_bool);
+    EXPECT_EQ(ParameterIOBackend::parseBool(text, converted_bool), is_bool) << "Bool conversion of \"" << text << "\" differs from yaml-cpp";
+    if (is_bool)
+    {
+      EXPECT_EQ(converted_bool, expected_bool) << "Bool value of \"" << text << "\" differs from yaml-cpp";
+    }
+  }
+}
+
+TEST(ParameterIOBackendTest, ConvertTest)
+{
+  EXPECT_EQ(std::any_cast<int>(ParameterIOBackend::convertScalar("42")), 42);
+  EXPECT_EQ(std::any_cast<double>(ParameterIOBackend::convertScalar("4.0")), 4.0);
+  EXPECT_EQ(std::any_cast<bool>(ParameterIOBackend::convertScalar("true")), true);
+  EXPECT_EQ(std::any_cast<std::string>(ParameterIOBackend::convertScalar("text")), "text");
+
+  EXPECT_EQ(std::any_cast<std::vector<int>>(ParameterIOBackend::convertSequence({ "1", "2" })), (std::vector<int>{ 1, 2 }));
+  EXPECT_EQ(std::any_cast<std::vector<double>>(ParameterIOBackend::convertSequence({ "1", "2.5" })), (std::vector<double>{ 1.0, 2.5 }));
+  EXPECT_EQ(std::any_cast<std::vector<bool>>(ParameterIOBackend::convertSequence({ "true", "off" })), (std::vector<bool>{ true, false }));
+  EXPECT_EQ(std::any_cast<std::vector<std::string>>(ParameterIOBackend::convertSequence({ "1", "true" })), (std::vector<std::string>{ "1", "true" }));
+  EXPECT_EQ(std::any_cast<std::vector<int>>(ParameterIOBackend::convertSequence({})), std::vector<int>{}) << "Empty sequences are int vectors like in yaml-cpp";
+}
+
+TEST(ParameterIOBackendTest, TraverseParameterTreeTest)
+{
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("a/b/c", 1);
+  parameter_interface.setParam("a/b/d", 2);
+  parameter_interface.setParam("a/e", 3);
+  parameter_interface.setParam("f", 4);
+
+  RecordingVisitor visitor;
+  ParameterIOBackend::traverseParameterTree(parameter_interface, visitor);
+  std::vector<std::string> expected_events = { "begin a", "begin b", "c=a/b/c", "d=a/b/d", "end", "e=a/e", "end", "f=f" };
+  EXPECT_EQ(visitor.events, expected_events);
+}
+
+TEST(ParameterIOBackendTest, CreateForFileTest)
+{
+  EXPECT_NE(std::dynamic_pointer_cast<JsonIOBackend>(ParameterIOBackend::createForFile("config.json")), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<YamlIOBackend>(ParameterIOBackend::createForFile("config.yaml")), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<YamlIOBackend>(ParameterIOBackend::createForFile("json")), nullptr);
+
+  ParameterInterface parameter_interface;
+  EXPECT_TRUE(ParameterIOBackend::createForFile("random_order.json")->readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.json", parameter_interface));
+  EXPECT_EQ(parameter_interface.getParam<int>("category/parameter123_int"), -7);
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "paraminf/parameter_journal.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+namespace
+{
+void removeFiles(const std::string& base_file_path, const std::string& journal_file_path)
+{
+  std::remove(base_file_path.c_str());
+  std::remove(journal_file_path.c_str());
+}
+
+size_t fileSize(const std::string& file_path)
+{
+  std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+  return file ? static_cast<size_t>(file.tellg()) : 0;
+}
+}  // namespace
+
+TEST(ParameterJournalTest, ReplayTest)
+{
+  const std::string base_file_path = "JournalReplayTestBase.yaml";
+  const std::string journal_file_path = "JournalReplayTestOut.journal";
+  removeFiles(base_file_path, journal_file_path);
+
+  ParameterInterface base;
+  base.setParam("controller/gain", 1.5);
+  base.setParam("controller/rate", 100);
+  base.setParam("controller/name", std::string("pid"));
+  ASSERT_TRUE(YamlIOHandler::writeParametersToFile(base_file_path, base));
+
+  {
+    ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+    ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+    EXPECT_EQ(parameter_interface->getParam<int>("controller/rate"), 100) << "Base snapshot was not loaded";
+    EXPECT_EQ(journal.getReplayedRecordCount(), 0);
+
+    journal.setParam("controller/gain", 2.5);
+    journal.setParam("controller/joints", std::vector<std::string>{ "joint_1", "joint_2" });
+    journal.setParam("controller/limits", std::vector<double>{ -1.0, 1.0 });
+    EXPECT_TRUE(journal.removeParam("controller/name"));
+    EXPECT_FALSE(journal.removeParam("controller/unknown"));
+    EXPECT_EQ(parameter_interface->getParam<double>("controller/gain"), 2.5);
+    ASSERT_TRUE(journal.sync().get());
+    EXPECT_EQ(fileSize(journal_file_path), journal.getJournalSize());
+  }
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+  EXPECT_EQ(journal.getReplayedRecordCount(), 4);
+  EXPECT_EQ(parameter_interface->getParam<double>("controller/gain"), 2.5);
+  EXPECT_EQ(parameter_interface->getParam<int>("controller/rate"), 100);
+  EXPECT_EQ(parameter_interface->getParam<std::vector<std::string>>("controller/joints"), (std::vector<std::string>{ "joint_1", "joint_2" }));
+  EXPECT_EQ(parameter_interface->getParam<std::vector<double>>("controller/limits"), (std::vector<double>{ -1.0, 1.0 }));
+  EXPECT_FALSE(parameter_interface->hasParam("controller/name")) << "Removal was not replayed";
+}
+
+TEST(ParameterJournalTest, TornRecordTest)
+{
+  const std::string base_file_path = "JournalTornTestBase.yaml";
+  const std::string journal_file_path = "JournalTornTestOut.journal";
+  removeFiles(base_file_path, journal_file_path);
+
+  size_t valid_size;
+  {
+    ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+    ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+    journal.setParam("first", 1);
+    journal.setParam("second", 2);
+    ASSERT_TRUE(journal.sync().get());
+    valid_size = journal.getJournalSize();
+    journal.setParam("third", std::string("torn"));
+    ASSERT_TRUE(journal.sync().get());
+  }
+
+  // simulate a crash while writing the last record
+  ASSERT_EQ(truncate(journal_file_path.c_str(), fileSize(journal_file_path) - 3), 0);
+  {
+    ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+    ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+    EXPECT_EQ(journal.getReplayedRecordCount(), 2);
+    EXPECT_EQ(journal.getJournalSize(), valid_size) << "Torn record was not truncated";
+    EXPECT_EQ(parameter_interface->getParam<int>("second"), 2);
+    EXPECT_FALSE(parameter_interface->hasParam("third"));
+
+    journal.setParam("third", std::string("complete"));
+    ASSERT_TRUE(journal.sync().get());
+  }
+
+  // corrupt the payload of the second record
+  {
+    std::fstream journal_file(journal_file_path, std::ios::binary | std::ios::in | std::ios::out);
+    journal_file.seekp(valid_size - 1);
+    journal_file.put('\x7f');
+  }
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+  EXPECT_EQ(journal.getReplayedRecordCount(), 1) << "Corrupt record was not detected";
+  EXPECT_EQ(parameter_interface->getParam<int>("first"), 1);
+  EXPECT_FALSE(parameter_interface->hasParam("second"));
+}
+
+TEST(ParameterJournalTest, CompactionTest)
+{
+  const std::string base_file_path = "JournalCompactionTestBase.yaml";
+  const std::string journal_file_path = "JournalCompactionTestOut.journal";
+  removeFiles(base_file_path, journal_file_path);
+
+  {
+    ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+    ParameterJournal journal(parameter_interface, base_file_path, journal_file_path, std::chrono::milliseconds(1), 4096);
+    for (int i = 0; i < 1000; i++)
+    {
+      journal.setParam("tuning/gain_" + std::to_string(i % 10), i);
+    }
+    ASSERT_TRUE(journal.requestCompaction().get());
+    EXPECT_GE(journal.getCompactionCount(), 1);
+    EXPECT_LT(journal.getJournalSize(), 4096) << "Journal has not been compacted";
+
+    ParameterInterface base;
+    ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(base_file_path, base));
+    EXPECT_EQ(base.getParam<int>("tuning/gain_9"), 999);
+
+    journal.setParam("tuning/gain_0", -1);
+    ASSERT_TRUE(journal.sync().get());
+  }
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+  EXPECT_EQ(parameter_interface->getParam<int>("tuning/gain_0"), -1);
+  EXPECT_EQ(parameter_interface->getParam<int>("tuning/gain_5"), 995);
+  EXPECT_EQ(parameter_interface->getAllParameterNames().size(), 10);
+}
+
+TEST(ParameterJournalTest, CallbackUpdateTest)
+{
+  const std::string base_file_path = "JournalCallbackTestBase.yaml";
+  const std::string journal_file_path = "JournalCallbackTestOut.journal";
+  removeFiles(base_file_path, journal_file_path);
+
+  {
+    ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+    ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+    // a synchronous callback deriving a parameter through the journal is called while the journal applies the update
+    parameter_interface->subscribe("controller/gain", [&](const std::vector<std::string>&) {
+      double gain;
+      if (parameter_interface->getParam("controller/gain", gain))
+        journal.setParam("controller/scaled_gain", 2.0 * gain);
+      else
+        journal.removeParam("controller/scaled_gain");
+    });
+    journal.setParam("controller/gain", 1.5);
+    EXPECT_EQ(parameter_interface->getParam<double>("controller/scaled_gain"), 3.0);
+    journal.setParam("controller/gain", 2.0);
+    EXPECT_TRUE(journal.removeParam("controller/gain"));
+    EXPECT_FALSE(parameter_interface->hasParam("controller/scaled_gain"));
+    journal.setParam("controller/gain", 4.0);
+    ASSERT_TRUE(journal.requestCompaction().get());
+    journal.setParam("controller/gain", 5.0);
+    ASSERT_TRUE(journal.sync().get());
+  }
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterJournal journal(parameter_interface, base_file_path, journal_file_path);
+  EXPECT_EQ(parameter_interface->getParam<double>("controller/gain"), 5.0);
+  EXPECT_EQ(parameter_interface->getParam<double>("controller/scaled_gain"), 10.0) << "Updates of the callback were not journaled in order";
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "paraminf/parameter_schema.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(ParameterSchemaTest, ReadSchemaTest)
+{
+  ParameterSchema schema;
+  std::vector<std::string> errors;
+  ASSERT_TRUE(YamlIOHandler::readSchemaFromFile(SOURCE_DIR "/test/test_yaml_files/schema.yaml", schema, errors)) << errors.front();
+
+  const ParameterSchema::Entry* entry = schema.findEntry("category/parameter111_double");
+  ASSERT_NE(entry, nullptr) << "Nested declaration was not found";
+  EXPECT_EQ(entry->type, ParameterSchema::Type::DOUBLE);
+  EXPECT_EQ(entry->min, -1.0);
+  EXPECT_EQ(entry->max, 1.0);
+
+  entry = schema.findEntry("category/missing_with_default");
+  ASSERT_NE(entry, nullptr);
+  ASSERT_TRUE(entry->default_value.has_value());
+  EXPECT_EQ(std::any_cast<int>(entry->default_value), 10);
+
+  EXPECT_TRUE(schema.findEntry("category/xyz/parameter112_string")->required);
+  EXPECT_EQ(schema.findEntry("category/not_declared"), nullptr);
+}
+
+TEST(ParameterSchemaTest, InvalidSchemaTest)
+{
+  ParameterSchema schema;
+  std::vector<std::string> errors;
+  EXPECT_FALSE(YamlIOHandler::readSchemaFromString("{ a: { type: float }, b: { type: int, default: 1.5 }, c: { type: bool, min: 0 }, "
+                                                   "d: { type: string, enum: [x, y], default: z }, e: { type: int, unit: m } }",
+                                                   schema, errors));
+  EXPECT_EQ(errors.size(), 5) << "Not all invalid declarations were reported";
+}
+
+TEST(ParameterSchemaTest, LoadWithSchemaTest)
+{
+  ParameterSchema schema;
+  std::vector<std::string> errors;
+  ASSERT_TRUE(YamlIOHandler::readSchemaFromFile(SOURCE_DIR "/test/test_yaml_files/schema.yaml", schema, errors));
+
+  ParameterInterface param_inf;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", param_inf, schema, errors)) << errors.front();
+
+  // declared types are used instead of guessing them
+  EXPECT_TRUE(param_inf.hasParamOfType<double>("category/parameter123_int"));
+  EXPECT_EQ(param_inf.getParam<double>("category/parameter123_int"), -7.0);
+  std::vector<double> expected_double = { -7.0, 0.0, 2.0, -5.0, 45.0 };
+  EXPECT_EQ(param_inf.getParam<std::vector<double>>("0therC4tegory/subcategory/subsubcategory/parameter223_int_vector"), expected_double);
+
+  // missing parameters are set to their defaults
+  EXPECT_EQ(param_inf.getParam<int>("category/missing_with_default"), 10);
+  std::vector<std::string> expected_string = { "a", "b" };
+  EXPECT_EQ(param_inf.getParam<std::vector<std::string>>("0therC4tegory/subcategory/subsubcategory/missing_vector"), expected_string);
+
+  // parameters that are not declared are still added
+  EXPECT_TRUE(param_inf.getParam<bool>("category/category2/paremeter124_bool"));
+}
+
+TEST(ParameterSchemaTest, LoadWithSchemaErrorsTest)
+{
+  ParameterSchema schema;
+  std::vector<std::string> errors;
+  ASSERT_TRUE(YamlIOHandler::readSchemaFromFile(SOURCE_DIR "/test/test_yaml_files/schema.yaml", schema, errors));
+
+  ParameterInterface param_inf;
+  param_inf.setParam("existing", 1);
+  param_inf.resetUpdateFlag();
+
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString("{ category: { parameter111_double: 2.0, parameter123_int: abc, missing_with_default: -1, "
+                                                             "parameter211_string_vector: [A, Z] }, other: 3 }",
+                                                             param_inf, schema, errors));
+
+  // out of range, wrong type, out of range, not allowed value and missing required parameter are reported together
+  EXPECT_EQ(errors.size(), 5) << "Not all errors were reported";
+
+  // the interface is left unchanged
+  EXPECT_FALSE(param_inf.hasBeenUpdated());
+  EXPECT_EQ(param_inf.getAllParameterNames(), std::vector<std::string>{ "existing" });
+}
+
+TEST(ParameterSchemaTest, LoadWithSchemaInvalidValuesTest)
+{
+  ParameterSchema schema;
+  std::vector<std::string> errors;
+  ASSERT_TRUE(YamlIOHandler::readSchemaFromString("{ gain: { type: double, min: 0.0 }, limit: { type: double, max: 1.0 }, scale: { type: double } }", schema, errors));
+
+  // NaN is not within any declared range, a declared scalar given as map is a type error
+  ParameterInterface param_inf;
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString("{ gain: .nan, limit: .nan, scale: { value: 1.0 } }", param_inf, schema, errors));
+  EXPECT_EQ(errors.size(), 3) << "Not all errors were reported";
+  EXPECT_FALSE(param_inf.hasParam("scale/value"));
+
+  errors.clear();
+  EXPECT_TRUE(YamlIOHandler::readAndAddParametersFromString("{ scale: .nan }", param_inf, schema, errors)) << "NaN without declared range was rejected";
+}
+
+}  // namespace test
+}  // namespace paraminf
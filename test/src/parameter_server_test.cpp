@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "paraminf/parameter_client.h"
+#include "paraminf/parameter_server.h"
+
+namespace paraminf
+{
+namespace test
+{
+std::string uniqueSocketPath(const std::string& test_name) { return "/tmp/paraminf_" + test_name + "_" + std::to_string(getpid()) + ".sock"; }
+
+TEST(ParameterServerTest, BatchGetAndSetTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("controller/gain", 2.5);
+  parameter_interface->setParam("controller/joints", std::vector<std::string>{ "hip", "knee" });
+  ParameterServer server(uniqueSocketPath("batch"), parameter_interface);
+  ParameterClient client(uniqueSocketPath("batch"));
+
+  ParameterInterface result;
+  ASSERT_TRUE(client.getParams({ "controller/gain", "controller/joints", "not_there" }, result));
+  EXPECT_EQ(result.getParam<double>("controller/gain"), 2.5);
+  EXPECT_EQ(result.getParam<std::vector<std::string>>("controller/joints"), (std::vector<std::string>{ "hip", "knee" }));
+  EXPECT_FALSE(result.hasParam("not_there")) << "Missing parameter was returned";
+
+  ParameterInterface updates;
+  updates.setParam("controller/gain", 3.0);
+  updates.setParam("controller/rate", 100);
+  ASSERT_TRUE(client.setParams(updates));
+  EXPECT_EQ(parameter_interface->getParam<double>("controller/gain"), 3.0);
+  EXPECT_EQ(parameter_interface->getParam<int>("controller/rate"), 100);
+}
+
+TEST(ParameterServerTest, PipelinedRequestsTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterServer server(uniqueSocketPath("pipeline"), parameter_interface);
+  ParameterClient client(uniqueSocketPath("pipeline"));
+
+  std::vector<uint32_t> request_ids;
+  for (int i = 0; i < 100; i++)
+  {
+    ParameterInterface update;
+    update.setParam("counter", i);
+    request_ids.push_back(client.sendSetRequest(update));
+    request_ids.push_back(client.sendGetRequest({ "counter" }));
+  }
+
+  // collect the responses in reverse order to test buffering of earlier responses
+  for (int i = 99; i >= 0; i--)
+  {
+    ParameterInterface result;
+    ASSERT_TRUE(client.receiveResponse(request_ids[2 * i + 1], &result));
+    EXPECT_EQ(result.getParam<int>("counter"), i) << "Pipelined requests were not processed in order";
+    EXPECT_TRUE(client.receiveResponse(request_ids[2 * i]));
+  }
+}
+
+TEST(ParameterServerTest, LoadFileAndSubscribeTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  ParameterServer server(uniqueSocketPath("subscribe"), parameter_interface);
+  ParameterClient subscriber(uniqueSocketPath("subscribe"));
+  ParameterClient client(uniqueSocketPath("subscribe"));
+
+  ASSERT_TRUE(subscriber.subscribe("category/category2/"));
+  ASSERT_TRUE(client.loadFile(std::string(SOURCE_DIR) + "/test/test_yaml_files/random_order.yaml"));
+  EXPECT_FALSE(client.loadFile(std::string(SOURCE_DIR) + "/test/test_yaml_files/not_there.yaml"));
+  EXPECT_TRUE(parameter_interface->hasParam("category/category2/paremeter124_bool"));
+
+  ParameterInterface changed;
+  ASSERT_TRUE(subscriber.waitForNotification(changed, std::chrono::seconds(5)));
+  for (const auto& parameter_name : changed.getAllParameterNames())
+  {
+    EXPECT_EQ(parameter_name.compare(0, 19, "category/category2/"), 0) << "Notified parameter " << parameter_name << " does not match the prefix";
+  }
+  EXPECT_TRUE(changed.hasParam("category/category2/paremeter124_bool"));
+
+  // only parameters whose value actually changed are pushed
+  ParameterInterface updates;
+  updates.setParam("category/category2/paremeter124_bool", parameter_interface->getParam<bool>("category/category2/paremeter124_bool"));
+  updates.setParam("category/category2/new", std::string("value"));
+  updates.setParam("category/new", true);
+  ASSERT_TRUE(client.setParams(updates));
+
+  ParameterInterface notified;
+  ASSERT_TRUE(subscriber.waitForNotification(notified, std::chrono::seconds(5)));
+  EXPECT_EQ(notified.getAllParameterNames(), std::vector<std::string>{ "category/category2/new" });
+  EXPECT_FALSE(subscriber.waitForNotification(notified, std::chrono::milliseconds(50)));
+
+  // requests following a file load observe the loaded parameters, although the file is parsed by another thread
+  ParameterClient loader(uniqueSocketPath("subscribe"));
+  ParameterInterface reset;
+  reset.setParam("category/category2/paremeter124_bool", !parameter_interface->getParam<bool>("category/category2/paremeter124_bool"));
+  ASSERT_TRUE(client.setParams(reset));
+  uint32_t load_request_id = loader.sendLoadFileRequest(std::string(SOURCE_DIR) + "/test/test_yaml_files/random_order.yaml");
+  uint32_t get_request_id = loader.sendGetRequest({ "category/category2/paremeter124_bool" });
+  ParameterInterface loaded;
+  ASSERT_TRUE(loader.receiveResponse(get_request_id, &loaded));
+  EXPECT_TRUE(loader.receiveResponse(load_request_id));
+  EXPECT_TRUE(loaded.getParam<bool>("category/category2/paremeter124_bool")) << "Request following the load was processed before it";
+
+  EXPECT_THROW(ParameterClient(uniqueSocketPath("not_there")), std::runtime_error);
+}
+
+TEST(ParameterServerTest, ClosedConnectionTest)
+{
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("large", std::string(64 * 1024, 'x'));
+  ParameterServer server(uniqueSocketPath("closed"), parameter_interface);
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, uniqueSocketPath("closed").c_str(), sizeof(address.sun_path) - 1);
+  int file_descriptor = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  ASSERT_EQ(connect(file_descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+
+  // the responses exceed the output limit of the server, which pauses reading until they have been received
+  const uint32_t request_count = 200;
+  std::string requests;
+  for (uint32_t i = 1; i <= request_count; i++)
+  {
+    ParameterProtocol::appendFrame(ParameterProtocol::Opcode::GET, i, ParameterProtocol::encodeNames({ "large" }), requests);
+  }
+  ASSERT_EQ(send(file_descriptor, requests.data(), requests.size(), MSG_NOSIGNAL), static_cast<ssize_t>(requests.size()));
+  ASSERT_EQ(shutdown(file_descriptor, SHUT_WR), 0);
+
+  // other clients are still served meanwhile
+  ParameterClient client(uniqueSocketPath("closed"));
+  ParameterInterface result;
+  ASSERT_TRUE(client.getParams({ "large" }, result));
+
+  // the requests sent before closing are answered before the server closes the connection
+  std::string responses;
+  char buffer[65536];
+  ssize_t received;
+  while ((received = recv(file_descriptor, buffer, sizeof(buffer), 0)) > 0)
+  {
+    responses.append(buffer, received);
+  }
+  close(file_descriptor);
+
+  size_t offset = 0;
+  uint32_t response_count = 0;
+  ParameterProtocol::Frame response;
+  bool error;
+  while (ParameterProtocol::extractFrame(responses, offset, response, error))
+  {
+    EXPECT_EQ(response.request_id, ++response_count);
+  }
+  EXPECT_FALSE(error);
+  EXPECT_EQ(response_count, request_count) << "Requests received before the connection was closed were not answered";
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "paraminf/parameter_interface.h"
+
+namespace paraminf
+{
+namespace test
+{
+namespace
+{
+using Names = std::vector<std::string>;
+
+// records the notifications of a subscription, which might be delivered by the dispatcher thread
+class NotificationRecorder
+{
+public:
+  ParameterSubscriptions::Callback callback()
+  {
+    return [this](const Names& names) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      notifications_.push_back(names);
+      condition_.notify_all();
+    };
+  }
+
+  std::vector<Names> waitForNotifications(size_t count)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait_for(lock, std::chrono::seconds(5), [this, count] { return notifications_.size() >= count; });
+    return notifications_;
+  }
+
+  std::vector<Names> getNotifications()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return notifications_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<Names> notifications_;
+};
+}  // namespace
+
+TEST(ParameterSubscriptionsTest, NamespaceMatchingTest)
+{
+  ParameterInterface parameter_interface;
+  NotificationRecorder arm;
+  NotificationRecorder root;
+  NotificationRecorder exact;
+  parameter_interface.subscribe("robot/arm/", arm.callback());
+  parameter_interface.subscribe("", root.callback());
+  parameter_interface.subscribe("robot/arm/gain", exact.callback());
+
+  parameter_interface.setParam("robot/arm/gain", 1.0);
+  parameter_interface.setParam("robot/armrest", 1);
+  parameter_interface.setParam("robot/arm/joints/count", 6);
+  EXPECT_TRUE(parameter_interface.removeParam("robot/arm/gain"));
+
+  EXPECT_EQ(arm.getNotifications(), (std::vector<Names>{ { "robot/arm/gain" }, { "robot/arm/joints/count" }, { "robot/arm/gain" } }))
+      << "Only parameters inside the namespace must be matched, not names sharing the prefix";
+  EXPECT_EQ(root.getNotifications().size(), 4);
+  EXPECT_EQ(exact.getNotifications(), (std::vector<Names>{ { "robot/arm/gain" }, { "robot/arm/gain" } }));
+}
+
+TEST(ParameterSubscriptionsTest, BatchedDeliveryTest)
+{
+  ParameterInterface parameter_interface;
+  NotificationRecorder recorder;
+  uint64_t subscription_id = parameter_interface.subscribe("robot", recorder.callback());
+
+  // a commit is a single write operation
+  parameter_interface.setParam("robot/b", 0);
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  transaction.setParam("robot/c", 1);
+  transaction.setParam("robot/a", 2);
+  transaction.setParam("other/a", 3);
+  transaction.removeParam("robot/b");
+  transaction.removeParam("robot/missing");
+  transaction.commit();
+  EXPECT_EQ(recorder.getNotifications().back(), (Names{ "robot/a", "robot/b", "robot/c" }));
+
+  ParameterInterface other;
+  other.setParam("robot/d", 4);
+  other.setParam("robot/e", 5);
+  parameter_interface.mergeParameters(other);
+  EXPECT_EQ(recorder.getNotifications().back(), (Names{ "robot/d", "robot/e" }));
+  EXPECT_EQ(recorder.getNotifications().size(), 3);
+
+  // callbacks are called without holding the lock, s.t. they can access the interface
+  size_t read_count = 0;
+  uint64_t reading_subscription_id = parameter_interface.subscribe("robot/a", [&](const Names& names) { read_count += parameter_interface.getParam<int>(names.front()); });
+  parameter_interface.setParam("robot/a", 3);
+  EXPECT_EQ(read_count, 3);
+
+  EXPECT_TRUE(parameter_interface.unsubscribe(subscription_id));
+  EXPECT_FALSE(parameter_interface.unsubscribe(subscription_id));
+  EXPECT_TRUE(parameter_interface.unsubscribe(reading_subscription_id));
+  parameter_interface.setParam("robot/a", 4);
+  EXPECT_EQ(recorder.getNotifications().size(), 4);
+  EXPECT_EQ(read_count, 3);
+
+  // copies do not take over the subscriptions
+  NotificationRecorder copy_recorder;
+  parameter_interface.subscribe("", copy_recorder.callback());
+  ParameterInterface copy(parameter_interface);
+  copy.setParam("robot/a", 5);
+  EXPECT_TRUE(copy_recorder.getNotifications().empty());
+}
+
+TEST(ParameterSubscriptionsTest, DispatcherCoalescingTest)
+{
+  ParameterInterface parameter_interface;
+  NotificationRecorder recorder;
+  parameter_interface.subscribe("robot", recorder.callback(), ParameterSubscriptions::Delivery::DISPATCHER, std::chrono::milliseconds(200));
+
+  // the burst arrives within the coalescing interval and is delivered as a single notification
+  for (int i = 0; i < 100; i++)
+  {
+    parameter_interface.setParam("robot/value_" + std::to_string(i % 10), i);
+  }
+  parameter_interface.setParam("other/value", 0);
+  std::vector<Names> notifications = recorder.waitForNotifications(1);
+  ASSERT_EQ(notifications.size(), 1);
+  EXPECT_EQ(notifications.front().size(), 10);
+  EXPECT_EQ(notifications.front().front(), "robot/value_0");
+
+  parameter_interface.setParam("robot/value_0", 1);
+  notifications = recorder.waitForNotifications(2);
+  ASSERT_EQ(notifications.size(), 2);
+  EXPECT_EQ(notifications.back(), (Names{ "robot/value_0" }));
+}
+
+TEST(ParameterSubscriptionsTest, UnsubscribeWaitsForCallbackTest)
+{
+  ParameterInterface parameter_interface;
+  std::atomic<bool> started{ false };
+  std::atomic<bool> finished{ false };
+  uint64_t subscription_id = parameter_interface.subscribe("robot", [&](const Names&) {
+    started = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    finished = true;
+  });
+
+  std::thread writer([&parameter_interface] { parameter_interface.setParam("robot/value", 1); });
+  while (!started)
+  {
+    std::this_thread::yield();
+  }
+  EXPECT_TRUE(parameter_interface.unsubscribe(subscription_id));
+  EXPECT_TRUE(finished) << "The running callback was not awaited";
+  writer.join();
+
+  // a callback removing its own subscription does not wait for itself
+  size_t call_count = 0;
+  subscription_id = parameter_interface.subscribe("robot", [&](const Names&) {
+    call_count++;
+    EXPECT_TRUE(parameter_interface.unsubscribe(subscription_id));
+  });
+  parameter_interface.setParam("robot/value", 2);
+  parameter_interface.setParam("robot/value", 3);
+  EXPECT_EQ(call_count, 1);
+}
+
+TEST(ParameterSubscriptionsTest, ThrowingCallbackTest)
+{
+  ParameterInterface parameter_interface;
+  NotificationRecorder recorder;
+  NotificationRecorder dispatched_recorder;
+  parameter_interface.subscribe("robot", [](const Names&) { throw std::runtime_error("synchronous"); });
+  parameter_interface.subscribe("robot", [](const Names&) { throw std::runtime_error("dispatched"); }, ParameterSubscriptions::Delivery::DISPATCHER);
+  parameter_interface.subscribe("robot", recorder.callback());
+  parameter_interface.subscribe("robot", dispatched_recorder.callback(), ParameterSubscriptions::Delivery::DISPATCHER);
+
+  // the change is applied and all other subscriptions are notified before the exception is rethrown
+  EXPECT_THROW(parameter_interface.setParam("robot/value", 1), std::runtime_error);
+  EXPECT_EQ(parameter_interface.getParam<int>("robot/value"), 1);
+  EXPECT_EQ(recorder.getNotifications(), (std::vector<Names>{ { "robot/value" } }));
+
+  // the dispatcher thread keeps running after a callback has thrown
+  EXPECT_EQ(dispatched_recorder.waitForNotifications(1).size(), 1);
+  EXPECT_THROW(parameter_interface.setParam("robot/value", 2), std::runtime_error);
+  EXPECT_EQ(dispatched_recorder.waitForNotifications(2).size(), 2);
+}
+
+TEST(ParameterSubscriptionsTest, MergeMovedParametersTest)
+{
+  ParameterInterface parameter_interface;
+  ParameterInterface other;
+  NotificationRecorder target_recorder;
+  NotificationRecorder source_recorder;
+  other.setParam("robot/a", 1);
+  parameter_interface.subscribe("", target_recorder.callback());
+  other.subscribe("", source_recorder.callback());
+
+  parameter_interface.mergeParameters(std::move(other));
+  EXPECT_EQ(target_recorder.getNotifications(), (std::vector<Names>{ { "robot/a" } }));
+  EXPECT_EQ(source_recorder.getNotifications(), (std::vector<Names>{ { "robot/a" } })) << "The moved parameters are removed from the source";
+
+  ParameterInterface assigned;
+  assigned.setParam("robot/b", 2);
+  parameter_interface = assigned;
+  EXPECT_EQ(target_recorder.getNotifications().back(), (Names{ "robot/a", "robot/b" }));
+}
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory_resource>
+
+#include <yaml-cpp/yaml.h>
+
+#include "paraminf/partitioned_parameter_store.h"
+
+namespace paraminf
+{
+namespace test
+{
+namespace
+{
+// removes the files listed in the manifest, the manifest and the directory
+void removeStore(const std::string& directory_path)
+{
+  try
+  {
+    YAML::Node manifest = YAML::LoadFile(directory_path + "/manifest.yaml");
+    for (const auto& entry : manifest["partitions"])
+    {
+      std::remove((directory_path + "/" + entry.second.as<std::string>()).c_str());
+    }
+  }
+  catch (const YAML::Exception&)
+  {
+  }
+  std::remove((directory_path + "/manifest.yaml").c_str());
+  rmdir(directory_path.c_str());
+}
+
+bool fileExists(const std::string& file_path) { return access(file_path.c_str(), F_OK) == 0; }
+}  // namespace
+
+TEST(PartitionedParameterStoreTest, SaveAndLoadTest)
+{
+  const std::string directory_path = "PartitionedStoreTestOut";
+  removeStore(directory_path);
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("rate", 10);
+  parameter_interface->setParam("robot_1/arm/gain", 1.5);
+  parameter_interface->setParam("robot_1/arm/joints", std::vector<std::string>{ "joint_1", "joint_2" });
+  parameter_interface->setParam("robot_2/id", std::string("second"));
+  {
+    PartitionedParameterStore store(parameter_interface, directory_path);
+    ASSERT_TRUE(store.save());
+    EXPECT_EQ(store.getWriteCount(), 3);
+    EXPECT_TRUE(fileExists(directory_path + "/root.yaml"));
+    EXPECT_TRUE(fileExists(directory_path + "/robot_1.yaml"));
+    EXPECT_TRUE(fileExists(directory_path + "/robot_2.yaml"));
+    EXPECT_TRUE(fileExists(store.getManifestPath()));
+  }
+
+  ParameterInterface::Ptr loaded_interface = std::make_shared<ParameterInterface>();
+  PartitionedParameterStore store(loaded_interface, directory_path);
+  ASSERT_TRUE(store.load());
+  EXPECT_EQ(loaded_interface->getAllParameterNames(), parameter_interface->getAllParameterNames());
+  EXPECT_EQ(loaded_interface->getFingerprint(), parameter_interface->getFingerprint());
+
+  // partitions that have just been loaded are not rewritten
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 0);
+
+  // the partitions are read concurrently without allocating from the resource of the interface, which does not need to be thread safe
+  auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>();
+  ParameterInterface::Ptr arena_interface = std::make_shared<ParameterInterface>(std::make_shared<StringPool>(), arena);
+  PartitionedParameterStore arena_store(arena_interface, directory_path, 1, 4);
+  ASSERT_TRUE(arena_store.load());
+  EXPECT_EQ(arena_interface->getFingerprint(), parameter_interface->getFingerprint());
+
+  ParameterInterface::Ptr missing_interface = std::make_shared<ParameterInterface>();
+  PartitionedParameterStore missing_store(missing_interface, "PartitionedStoreTestMissing");
+  EXPECT_FALSE(missing_store.load());
+  removeStore(directory_path);
+}
+
+TEST(PartitionedParameterStoreTest, IncrementalSaveTest)
+{
+  const std::string directory_path = "PartitionedStoreIncrementalTestOut";
+  removeStore(directory_path);
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  for (int i = 0; i < 10; i++)
+  {
+    parameter_interface->setParam("robot_" + std::to_string(i) + "/gain", i * 0.5);
+  }
+  PartitionedParameterStore store(parameter_interface, directory_path);
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 10);
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 10) << "Nothing changed since the last save";
+
+  // only the partition of the changed parameter is written
+  parameter_interface->setParam("robot_3/gain", 7.0);
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 11);
+
+  // setting the previous value does not change the fingerprint
+  parameter_interface->setParam("robot_4/gain", 2.0);
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 11);
+
+  // empty partitions are removed, new partitions are added to the manifest
+  ASSERT_TRUE(parameter_interface->removeParam("robot_5/gain"));
+  parameter_interface->setParam("robot_10/gain", 1.0);
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 12);
+  EXPECT_FALSE(fileExists(directory_path + "/robot_5.yaml"));
+  EXPECT_TRUE(fileExists(directory_path + "/robot_10.yaml"));
+
+  ParameterInterface::Ptr loaded_interface = std::make_shared<ParameterInterface>();
+  PartitionedParameterStore loaded_store(loaded_interface, directory_path);
+  ASSERT_TRUE(loaded_store.load());
+  EXPECT_EQ(loaded_interface->getAllParameterNames(), parameter_interface->getAllParameterNames());
+  EXPECT_EQ(loaded_interface->getParam<double>("robot_3/gain"), 7.0);
+  removeStore(directory_path);
+}
+
+TEST(PartitionedParameterStoreTest, PartitionDepthTest)
+{
+  const std::string directory_path = "PartitionedStoreDepthTestOut";
+  removeStore(directory_path);
+
+  ParameterInterface::Ptr parameter_interface = std::make_shared<ParameterInterface>();
+  parameter_interface->setParam("a/b/c", 1);
+  parameter_interface->setParam("a/d", 2);
+  parameter_interface->setParam("a.b/c", 3);
+  parameter_interface->setParam("a_b/c", 4);
+  {
+    PartitionedParameterStore store(parameter_interface, directory_path, 2);
+    ASSERT_TRUE(store.save());
+    EXPECT_EQ(store.getWriteCount(), 4);
+    EXPECT_TRUE(fileExists(directory_path + "/a.yaml"));
+    EXPECT_TRUE(fileExists(directory_path + "/a.b.yaml"));
+    // the file names of "a.b" and "a_b" collide and are made unique
+    EXPECT_TRUE(fileExists(directory_path + "/a_b.yaml"));
+    EXPECT_TRUE(fileExists(directory_path + "/a_b_2.yaml"));
+  }
+
+  // a store with another depth rewrites the directory with its own partitions on save
+  ParameterInterface::Ptr loaded_interface = std::make_shared<ParameterInterface>();
+  PartitionedParameterStore store(loaded_interface, directory_path, 1);
+  ASSERT_TRUE(store.load());
+  EXPECT_EQ(loaded_interface->getAllParameterNames(), parameter_interface->getAllParameterNames());
+  ASSERT_TRUE(store.save());
+  EXPECT_EQ(store.getWriteCount(), 3);
+  EXPECT_TRUE(fileExists(directory_path + "/a.yaml"));
+  EXPECT_FALSE(fileExists(directory_path + "/a.b.yaml")) << "The partition \"a/b\" has been merged into \"a\"";
+
+  ParameterInterface::Ptr reloaded_interface = std::make_shared<ParameterInterface>();
+  PartitionedParameterStore reloaded_store(reloaded_interface, directory_path, 1);
+  ASSERT_TRUE(reloaded_store.load());
+  EXPECT_EQ(reloaded_interface->getAllParameterNames(), parameter_interface->getAllParameterNames());
+  removeStore(directory_path);
+}
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "paraminf/json_io_handler.h"
+#include "paraminf/parameter_codec.h"
+#include "paraminf/raw_parameter_value.h"
+#include "paraminf/yaml_io_handler.h"
+
+namespace paraminf
+{
+namespace test
+{
+namespace
+{
+RawParameterValue makeScalar(const std::string& text)
+{
+  RawParameterValue::Builder builder;
+  return builder.addScalar(text);
+}
+
+RawParameterValue makeSequence(const std::vector<std::string_view>& elements)
+{
+  RawParameterValue::Builder builder;
+  return builder.addSequence(elements);
+}
+
+void expectEqualEncodings(const ParameterInterface& expected, const ParameterInterface& actual)
+{
+  ASSERT_EQ(actual.getAllParameterNames(), expected.getAllParameterNames());
+  for (const auto& parameter_name : expected.getAllParameterNames())
+  {
+    std::string expected_value;
+    std::string actual_value;
+    ASSERT_TRUE(ParameterCodec::encodeParameter(expected, parameter_name, expected_value));
+    ASSERT_TRUE(ParameterCodec::encodeParameter(actual, parameter_name, actual_value));
+    EXPECT_EQ(actual_value, expected_value) << "Parameter \"" << parameter_name << "\" differs in type or value";
+  }
+}
+}  // namespace
+
+TEST(RawParameterValueTest, ScalarConversionTest)
+{
+  RawParameterValue number = makeScalar("42");
+  int int_value;
+  double double_value;
+  bool bool_value;
+  std::string string_value;
+  EXPECT_TRUE(number.convert(int_value));
+  EXPECT_EQ(int_value, 42);
+  EXPECT_TRUE(number.convert(double_value));
+  EXPECT_EQ(double_value, 42.0);
+  EXPECT_TRUE(number.convert(string_value));
+  EXPECT_EQ(string_value, "42");
+  EXPECT_FALSE(number.convert(bool_value));
+  std::vector<int> vector_value;
+  EXPECT_FALSE(number.convert(vector_value)) << "Scalars must not be converted to vectors";
+  EXPECT_EQ(std::any_cast<int>(number.resolve()), 42);
+
+  RawParameterValue flag = makeScalar("Yes");
+  EXPECT_TRUE(flag.convert(bool_value));
+  EXPECT_TRUE(bool_value);
+  EXPECT_FALSE(flag.convert(int_value));
+  EXPECT_TRUE(std::any_cast<bool>(flag.resolve()));
+
+  EXPECT_EQ(std::any_cast<double>(makeScalar("1.5").resolve()), 1.5);
+  EXPECT_EQ(std::any_cast<std::string>(makeScalar("frame").resolve()), "frame");
+}
+
+TEST(RawParameterValueTest, SequenceConversionTest)
+{
+  RawParameterValue sequence = makeSequence({ "1", "2.5", "" });
+  EXPECT_TRUE(sequence.isSequence());
+  EXPECT_EQ(sequence.getElements(), (std::vector<std::string_view>{ "1", "2.5", "" }));
+
+  std::vector<double> double_values;
+  std::vector<std::string> string_values;
+  EXPECT_FALSE(sequence.convert(double_values)) << "The empty element is not a double";
+  EXPECT_TRUE(sequence.convert(string_values));
+  EXPECT_EQ(string_values, (std::vector<std::string>{ "1", "2.5", "" }));
+
+  RawParameterValue numbers = makeSequence({ "1", "2.5" });
+  EXPECT_TRUE(numbers.convert(double_values));
+  EXPECT_EQ(double_values, (std::vector<double>{ 1.0, 2.5 }));
+  EXPECT_EQ(std::any_cast<std::vector<double>>(numbers.resolve()), (std::vector<double>{ 1.0, 2.5 }));
+  int int_value;
+  EXPECT_FALSE(numbers.convert(int_value)) << "Sequences must not be converted to scalars";
+
+  EXPECT_EQ(std::any_cast<std::vector<int>>(makeSequence({}).resolve()), std::vector<int>{});
+}
+
+TEST(RawParameterValueTest, BuilderTest)
+{
+  std::vector<RawParameterValue> values;
+  {
+    RawParameterValue::Builder builder;
+    for (int i = 0; i < 10000; i++)
+    {
+      values.push_back(builder.addScalar(std::to_string(i)));
+    }
+    // records larger than a block get a block of their own
+    values.push_back(builder.addScalar(std::string(100000, 'x')));
+  }
+
+  // the values keep the blocks alive after the builder has been destroyed
+  for (int i = 0; i < 10000; i++)
+  {
+    int value;
+    ASSERT_TRUE(values[i].convert(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_EQ(values.back().getText().size(), 100000);
+
+  RawParameterValue moved = std::move(values.front());
+  EXPECT_EQ(moved.getText(), "0");
+  EXPECT_EQ(sizeof(RawParameterValue), sizeof(void*)) << "Raw values should be stored inside std::any without an allocation";
+}
+
+TEST(RawParameterValueTest, DeferredYamlMatchesEagerTest)
+{
+  ParameterInterface eager_parameters;
+  ParameterInterface deferred_parameters;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", eager_parameters));
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", deferred_parameters,
+                                                          ParameterIOBackend::Conversion::DEFERRED));
+  expectEqualEncodings(eager_parameters, deferred_parameters);
+  EXPECT_EQ(deferred_parameters.getFingerprint(), eager_parameters.getFingerprint()) << "Raw values must be hashed like their eager conversion";
+
+  // writing resolves the raw values, so the written files are identical
+  std::string eager_output;
+  std::string deferred_output;
+  ASSERT_TRUE(YamlIOHandler::writeParametersToString(eager_parameters, eager_output));
+  ASSERT_TRUE(YamlIOHandler::writeParametersToString(deferred_parameters, deferred_output));
+  EXPECT_EQ(deferred_output, eager_output);
+}
+
+TEST(RawParameterValueTest, DeferredJsonMatchesEagerTest)
+{
+  ParameterInterface eager_parameters;
+  ParameterInterface deferred_parameters;
+  ASSERT_TRUE(JsonIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.json", eager_parameters));
+  ASSERT_TRUE(ParameterIOBackend::createForFile("random_order.json", ParameterIOBackend::Conversion::DEFERRED)
+                  ->readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.json", deferred_parameters));
+  expectEqualEncodings(eager_parameters, deferred_parameters);
+
+  ParameterInterface escaped_parameters;
+  ASSERT_TRUE(JsonIOHandler::readAndAddParametersFromString(R"({"a": {"escaped": "x\ty", "vector": ["\"q\"", "1"], "empty": []}})", escaped_parameters,
+                                                            ParameterIOBackend::Conversion::DEFERRED));
+  EXPECT_EQ(escaped_parameters.getParam<std::string>("a/escaped"), "x\ty");
+  EXPECT_EQ(escaped_parameters.getParam<std::vector<std::string>>("a/vector"), (std::vector<std::string>{ "\"q\"", "1" }));
+  EXPECT_EQ(escaped_parameters.getParam<std::vector<int>>("a/empty"), std::vector<int>{});
+}
+
+TEST(RawParameterValueTest, TypedAccessTest)
+{
+  ParameterInterface parameter_interface;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString("a: {number: 12, ratio: 0.5, flag: on, name: base, list: [1, 2]}", parameter_interface,
+                                                            ParameterIOBackend::Conversion::DEFERRED));
+
+  // the requested type decides the conversion instead of the first type that succeeds
+  EXPECT_EQ(parameter_interface.getParam<int>("a/number"), 12);
+  EXPECT_EQ(parameter_interface.getParam<std::string>("a/number"), "12");
+  EXPECT_EQ(parameter_interface.getParam<double>("a/number"), 12.0);
+  EXPECT_EQ(parameter_interface.getParam<long>("a/number"), 12) << "Types convertible from int are converted like for eager values";
+  EXPECT_TRUE(parameter_interface.hasParamOfType<std::string>("a/number"));
+  EXPECT_FALSE(parameter_interface.hasParamOfType<int>("a/ratio"));
+  EXPECT_TRUE(parameter_interface.hasParamOfType<double>("a/ratio"));
+  EXPECT_TRUE(parameter_interface.getParam<bool>("a/flag"));
+  EXPECT_EQ(parameter_interface.getParam<std::string>("a/name"), "base");
+  EXPECT_FALSE(parameter_interface.hasParamOfType<int>("a/name"));
+  EXPECT_EQ(parameter_interface.getParam<std::vector<int>>("a/list"), (std::vector<int>{ 1, 2 }));
+  EXPECT_EQ(parameter_interface.getParam<std::vector<std::string>>("a/list"), (std::vector<std::string>{ "1", "2" }));
+  EXPECT_FALSE(parameter_interface.hasParamOfType<std::vector<bool>>("a/list"));
+  EXPECT_TRUE(parameter_interface.hasParamOfType<RawParameterValue>("a/list"));
+
+  // copies share the buffer and the cached conversions
+  ParameterInterface copy(parameter_interface);
+  EXPECT_EQ(copy.getParam<int>("a/number"), 12);
+
+  // conversions to several types are cached side by side
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(copy.getParam<int>("a/number"), 12);
+    EXPECT_EQ(copy.getParam<std::string>("a/number"), "12");
+    EXPECT_EQ(copy.getParam<double>("a/number"), 12.0);
+  }
+
+  // concurrent first accesses of readers
+  std::vector<std::thread> threads;
+  ParameterInterface concurrent;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString("value: 7", concurrent, ParameterIOBackend::Conversion::DEFERRED));
+  for (int i = 0; i < 4; i++)
+  {
+    threads.emplace_back([&concurrent, i]() {
+      for (int j = 0; j < 1000; j++)
+      {
+        if (i % 2 == 0)
+          EXPECT_EQ(concurrent.getParam<int>("value"), 7);
+        else
+          EXPECT_EQ(concurrent.getParam<std::string>("value"), "7");
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+TEST(RawParameterValueTest, InvalidDeferredInputTest)
+{
+  ParameterInterface parameter_interface;
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString("a: 1\nb: [1, [2]]", parameter_interface, ParameterIOBackend::Conversion::DEFERRED));
+  EXPECT_FALSE(JsonIOHandler::readAndAddParametersFromString(R"({"a": 1, "b": null})", parameter_interface, ParameterIOBackend::Conversion::DEFERRED));
+  EXPECT_TRUE(parameter_interface.getAllParameterNames().empty()) << "Invalid input must not add any parameters";
+}
+}  // namespace test
+}  // namespace paraminf
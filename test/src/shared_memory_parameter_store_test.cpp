@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "paraminf/shared_memory_parameter_store.h"
+
+namespace paraminf
+{
+namespace test
+{
+std::string uniqueSegmentName(const std::string& test_name) { return "/paraminf_" + test_name + "_" + std::to_string(getpid()); }
+
+TEST(SharedMemoryParameterStoreTest, PublishAndReadTest)
+{
+  std::string segment_name = uniqueSegmentName("publish");
+  SharedMemoryParameterStore writer(segment_name, 1 << 16);
+
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("controller/gain", 2.5);
+  parameter_interface.setParam("controller/rate", 100);
+  parameter_interface.setParam("frame", std::string("base_link"));
+  parameter_interface.setParam("joints", std::vector<std::string>{ "hip", "knee" });
+  ASSERT_TRUE(writer.publish(parameter_interface));
+
+  SharedMemoryParameterStore reader(segment_name);
+  EXPECT_EQ(reader.getVersion(), 1);
+  EXPECT_EQ(reader.getParam<double>("controller/gain"), 2.5);
+  EXPECT_EQ(reader.getParam<int>("controller/rate"), 100);
+  EXPECT_EQ(reader.getParam<double>("controller/rate"), 100.0) << "Int parameter was not converted to double";
+  EXPECT_EQ(reader.getParam<std::string>("frame"), "base_link");
+  EXPECT_EQ(reader.getParam<std::vector<std::string>>("joints"), (std::vector<std::string>{ "hip", "knee" }));
+  EXPECT_TRUE(reader.hasParam("frame"));
+  EXPECT_FALSE(reader.hasParam("not_there"));
+  EXPECT_TRUE(reader.hasParamOfType<std::string>("frame"));
+  EXPECT_FALSE(reader.hasParamOfType<int>("frame"));
+  EXPECT_ANY_THROW(reader.getParam<int>("not_there"));
+  EXPECT_EQ(reader.getAllParameterNames(), parameter_interface.getAllParameterNames());
+
+  parameter_interface.setParam("controller/gain", 3.0);
+  parameter_interface.removeParam("frame");
+  ASSERT_TRUE(writer.publish(parameter_interface));
+  EXPECT_EQ(reader.getVersion(), 2);
+  EXPECT_EQ(reader.getParam<double>("controller/gain"), 3.0) << "Published update was not visible";
+  EXPECT_FALSE(reader.hasParam("frame")) << "Removed parameter was still visible";
+
+  ParameterInterface snapshot;
+  reader.readAll(snapshot);
+  EXPECT_EQ(snapshot.getAllParameterNames(), parameter_interface.getAllParameterNames());
+
+  // readers can not publish
+  EXPECT_FALSE(reader.publish(parameter_interface));
+}
+
+TEST(SharedMemoryParameterStoreTest, CapacityAndErrorsTest)
+{
+  std::string segment_name = uniqueSegmentName("capacity");
+  SharedMemoryParameterStore writer(segment_name, 64);
+
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("long_vector", std::vector<double>(100, 1.0));
+  EXPECT_FALSE(writer.publish(parameter_interface)) << "Exceeding the capacity was not detected";
+
+  ParameterInterface unsupported;
+  unsupported.setParam("float", 1.0f);
+  EXPECT_FALSE(writer.publish(unsupported)) << "Unsupported type was published";
+
+  EXPECT_THROW(SharedMemoryParameterStore(uniqueSegmentName("not_there")), std::runtime_error);
+}
+
+TEST(SharedMemoryParameterStoreTest, ConsistentConcurrentReadTest)
+{
+  std::string segment_name = uniqueSegmentName("concurrent");
+  SharedMemoryParameterStore writer(segment_name, 1 << 16);
+  SharedMemoryParameterStore reader(segment_name);
+
+  std::atomic<bool> done = false;
+  std::thread writer_thread([&] {
+    ParameterInterface parameter_interface;
+    for (int i = 0; i < 2000; i++)
+    {
+      parameter_interface.setParam("a", i);
+      parameter_interface.setParam("b", std::vector<int>(i % 50, i));
+      writer.publish(parameter_interface);
+    }
+    done = true;
+  });
+
+  // every snapshot has to contain values of the same publish
+  while (!done)
+  {
+    ParameterInterface snapshot;
+    reader.readAll(snapshot);
+    if (!snapshot.hasParam("a"))
+      continue;
+    int a = snapshot.getParam<int>("a");
+    std::vector<int> b = snapshot.getParam<std::vector<int>>("b");
+    ASSERT_EQ(b.size(), static_cast<size_t>(a % 50));
+    for (int element : b)
+    {
+      ASSERT_EQ(element, a) << "Inconsistent snapshot was read";
+    }
+  }
+  writer_thread.join();
+}
+
+TEST(SharedMemoryParameterStoreTest, InterruptedPublishTest)
+{
+  std::string segment_name = uniqueSegmentName("interrupted");
+  SharedMemoryParameterStore writer(segment_name, 1 << 16);
+  ParameterInterface parameter_interface;
+  parameter_interface.setParam("a", 1);
+  ASSERT_TRUE(writer.publish(parameter_interface));
+  SharedMemoryParameterStore reader(segment_name, std::chrono::milliseconds(50));
+
+  // leave the sequence number odd as a writer that died while publishing would, it follows the magic number and the capacity
+  int file_descriptor = shm_open(segment_name.c_str(), O_RDWR, 0);
+  ASSERT_GE(file_descriptor, 0);
+  void* address = mmap(nullptr, 3 * sizeof(uint64_t), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+  close(file_descriptor);
+  ASSERT_NE(address, MAP_FAILED);
+  auto* sequence = static_cast<std::atomic<uint64_t>*>(address) + 2;
+  uint64_t published_sequence = sequence->load();
+  sequence->store(published_sequence + 1);
+
+  auto start = std::chrono::steady_clock::now();
+  ParameterInterface snapshot;
+  EXPECT_FALSE(reader.readAll(snapshot));
+  EXPECT_FALSE(snapshot.hasParam("a"));
+  EXPECT_FALSE(reader.hasParam("a"));
+  EXPECT_ANY_THROW(reader.getParam<int>("a"));
+  EXPECT_TRUE(reader.getAllParameterNames().empty());
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5)) << "Reads did not time out";
+
+  sequence->store(published_sequence);
+  EXPECT_EQ(reader.getParam<int>("a"), 1);
+  munmap(address, 3 * sizeof(uint64_t));
+}
+
+}  // namespace test
+}  // namespace paraminf
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "paraminf/parameter_interface.h"
+#include "paraminf/string_pool.h"
+
+namespace paraminf
+{
+namespace test
+{
+TEST(StringPoolTest, InternTest)
+{
+  StringPool pool;
+  InternedString first = pool.intern("base_link_frame_of_the_robot");
+  InternedString second = pool.intern(std::string("base_link_frame_of_the_robot"));
+  InternedString other = pool.intern("odom");
+
+  EXPECT_EQ(first, second) << "Equal strings were not interned to the same address";
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_STREQ(first.c_str(), "base_link_frame_of_the_robot");
+  EXPECT_NE(first, other);
+  EXPECT_EQ(first.str(), "base_link_frame_of_the_robot");
+  EXPECT_EQ(pool.size(), 2);
+  EXPECT_GT(pool.getMemoryUsage(), 0);
+
+  StringPool other_pool;
+  EXPECT_NE(other_pool.intern("odom"), other) << "Strings of different pools must not share their storage";
+  EXPECT_EQ(InternedString().str(), "");
+  EXPECT_EQ(pool.intern(""), InternedString());
+}
+
+TEST(StringPoolTest, ReleaseTest)
+{
+  auto pool = std::make_shared<StringPool>();
+  {
+    InternedString value = pool->intern("temporary_value_that_is_long_enough");
+    EXPECT_EQ(pool->size(), 1);
+  }
+  EXPECT_EQ(pool->size(), 0) << "String was not released after its last handle was destroyed";
+
+  // handles stay valid after the pool has been destroyed
+  InternedString value = pool->intern("outliving_value");
+  pool.reset();
+  EXPECT_EQ(value.str(), "outliving_value");
+}
+
+TEST(StringPoolTest, GrowAndShrinkTest)
+{
+  StringPool pool;
+  std::vector<InternedString> values;
+  for (int i = 0; i < 1000; i++)
+  {
+    values.push_back(pool.intern("value_" + std::to_string(i)));
+  }
+  EXPECT_EQ(pool.size(), 1000);
+
+  // release every other string, the remaining ones must still be found
+  for (size_t i = 0; i < values.size(); i += 2)
+  {
+    values[i] = InternedString();
+  }
+  EXPECT_EQ(pool.size(), 500);
+  for (int i = 1; i < 1000; i += 2)
+  {
+    EXPECT_EQ(pool.intern("value_" + std::to_string(i)), values[i]);
+  }
+  EXPECT_EQ(pool.size(), 500);
+}
+
+TEST(StringPoolTest, ConcurrentInternTest)
+{
+  StringPool pool;
+  std::vector<std::thread> threads;
+  std::vector<std::vector<InternedString>> results(4);
+  for (size_t t = 0; t < results.size(); t++)
+  {
+    threads.emplace_back([&pool, &results, t]() {
+      for (int i = 0; i < 10000; i++)
+      {
+        InternedString value = pool.intern("value_" + std::to_string(i % 100));
+        if (i % 3 == 0)
+          results[t].push_back(value);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (size_t t = 1; t < results.size(); t++)
+  {
+    ASSERT_EQ(results[t].size(), results[0].size());
+    for (size_t i = 0; i < results[t].size(); i++)
+    {
+      EXPECT_EQ(results[t][i], results[0][i]);
+    }
+  }
+  EXPECT_EQ(pool.size(), 100);
+}
+
+TEST(StringPoolTest, ParameterInterfaceInterningTest)
+{
+  auto pool = std::make_shared<StringPool>();
+  ParameterInterface parameter_interface(pool);
+  parameter_interface.setParam("robot_1/frame", std::string("base_link"));
+  parameter_interface.setParam("robot_2/frame", std::string("base_link"));
+  parameter_interface.setParam("robot_1/joints", std::vector<std::string>{ "base_link", "arm" });
+
+  EXPECT_EQ(parameter_interface.getParam<InternedString>("robot_1/frame"), parameter_interface.getParam<InternedString>("robot_2/frame"));
+  EXPECT_EQ(parameter_interface.getParam<InternedString>("robot_1/frame"), pool->intern("base_link"));
+  EXPECT_EQ(parameter_interface.getParam<std::string>("robot_1/frame"), "base_link");
+  EXPECT_TRUE(parameter_interface.hasParamOfType<std::string>("robot_1/frame"));
+  EXPECT_EQ(parameter_interface.getParam<std::vector<InternedString>>("robot_1/joints")[0], pool->intern("base_link"));
+  EXPECT_EQ(parameter_interface.getParam<std::vector<std::string>>("robot_1/joints"), (std::vector<std::string>{ "base_link", "arm" }));
+
+  // names and values are stored once, i.e. the three names, "base_link" and "arm"
+  EXPECT_EQ(pool->size(), 5);
+
+  // copies share the pool, merging from another pool interns the strings in the own pool
+  ParameterInterface copy = parameter_interface;
+  EXPECT_EQ(copy.getStringPool(), pool);
+  ParameterInterface separate;
+  separate.setParam("robot_3/frame", std::string("base_link"));
+  parameter_interface.mergeParameters(separate);
+  EXPECT_EQ(parameter_interface.getParam<InternedString>("robot_3/frame"), pool->intern("base_link"));
+
+  ParameterInterface::Transaction transaction = parameter_interface.beginTransaction();
+  transaction.setParam("robot_4/frame", std::string("base_link"));
+  transaction.commit();
+  EXPECT_EQ(parameter_interface.getParam<InternedString>("robot_4/frame"), pool->intern("base_link"));
+
+  EXPECT_THROW(ParameterInterface(StringPool::Ptr()), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace paraminf
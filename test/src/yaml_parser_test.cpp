@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <fstream>
+#include <memory_resource>
+#include <thread>
 
 #include "paraminf/yaml_io_handler.h"
 #include "paraminf/parameter_interface.h"
@@ -8,6 +11,27 @@ namespace paraminf
 {
 namespace test
 {
+// memory resource that records whether it has been used by another thread than the one that created it
+class SingleThreadMemoryResource : public std::pmr::memory_resource
+{
+public:
+  std::atomic<bool> used_by_other_thread{ false };
+
+private:
+  void* do_allocate(size_t bytes, size_t alignment) override
+  {
+    if (std::this_thread::get_id() != owner_thread_)
+      used_by_other_thread = true;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override { std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment); }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  std::thread::id owner_thread_ = std::this_thread::get_id();
+};
+
 template <typename T>
 void testGetSingleParameter(const std::string& parameter_name, T expected_result, T init_value, ParameterInterface& param_inf, const std::string& error_message = "")
 {
@@ -77,16 +101,19 @@ TEST(YamlIOTest, ReadFileAndTestParameterVectors)
 
 TEST(YamlIOTest, WriteFile)
 {
+  // the written files are placed in the temporary directory of the test instead of the working directory
+  const std::string first_output_path = ::testing::TempDir() + "WriteFileTestOut.yaml";
+  const std::string second_output_path = ::testing::TempDir() + "WriteFileTestOut2.yaml";
   ParameterInterface parameter_interface;
 
   ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(SOURCE_DIR "/test/test_yaml_files/random_order.yaml", parameter_interface));
   // read parameters of original file and write them again to new file
-  ASSERT_TRUE(YamlIOHandler::writeParametersToFile("WriteFileTestOut.yaml", parameter_interface));
+  ASSERT_TRUE(YamlIOHandler::writeParametersToFile(first_output_path, parameter_interface));
 
   std::ifstream ifs_expected(SOURCE_DIR "/test/test_yaml_files/expected_result_ordered.yaml");
   std::string content_expected((std::istreambuf_iterator<char>(ifs_expected)), (std::istreambuf_iterator<char>()));
 
-  std::ifstream ifs_first_write("WriteFileTestOut.yaml");
+  std::ifstream ifs_first_write(first_output_path);
   ASSERT_TRUE(ifs_first_write.good());
 
   std::string content_first_write((std::istreambuf_iterator<char>(ifs_first_write)), (std::istreambuf_iterator<char>()));
@@ -94,10 +121,10 @@ TEST(YamlIOTest, WriteFile)
 
   // reread parameters of the new file and make sure they are all parsed correctly by writing them again
   ParameterInterface reread;
-  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile("WriteFileTestOut.yaml", reread));
-  ASSERT_TRUE(YamlIOHandler::writeParametersToFile("WriteFileTestOut2.yaml", reread));
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromFile(first_output_path, reread));
+  ASSERT_TRUE(YamlIOHandler::writeParametersToFile(second_output_path, reread));
 
-  std::ifstream ifs_second_write("WriteFileTestOut2.yaml");
+  std::ifstream ifs_second_write(second_output_path);
   ASSERT_TRUE(ifs_first_write.good());
   std::string content_second_write((std::istreambuf_iterator<char>(ifs_second_write)), (std::istreambuf_iterator<char>()));
 
@@ -224,5 +251,106 @@ TEST(YamlIOTest, ReadNodeAndTestParameters)
   testGetParameterVector("test_string_vec", expected_string, param_inf, "String vector was read incorrectly");
 }
 
+TEST(YamlIOTest, ParallelWriteMatchesSequentialWrite)
+{
+  ParameterInterface param_inf;
+  for (int i = 0; i < 40000; i++)
+  {
+    std::string name = "namespace_" + std::to_string(i % 37) + "/sub_" + std::to_string(i % 5) + "/parameter_" + std::to_string(i);
+    switch (i % 5)
+    {
+      case 0:
+        param_inf.setParam(name, i);
+        break;
+      case 1:
+        param_inf.setParam(name, i * 0.5);
+        break;
+      case 2:
+        // strings that have to be quoted
+        param_inf.setParam(name, std::string(i % 2 ? "key: value" : "yes"));
+        break;
+      case 3:
+        param_inf.setParam(name, std::vector<std::string>{ "a", "", "b c" });
+        break;
+      default:
+        param_inf.setParam(name, std::vector<double>{ 1.0, -2.5 });
+        break;
+    }
+  }
+  param_inf.setParam("top_level_int", 1);
+  param_inf.setParam("namespace_1-suffix", std::string("sorted between namespace_1 and its parameters"));
+  param_inf.setParam("zz/" + std::string(2000, 'k'), true);
+
+  std::string sequential_output;
+  ASSERT_TRUE(YamlIOHandler::writeParametersToString(param_inf, sequential_output, 1));
+  for (size_t thread_count : { 2, 3, 8 })
+  {
+    std::string parallel_output;
+    ASSERT_TRUE(YamlIOHandler::writeParametersToString(param_inf, parallel_output, thread_count));
+    EXPECT_TRUE(parallel_output == sequential_output) << "Output of " << thread_count << " threads differs from the sequential output";
+  }
+
+  ParameterInterface reread;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(sequential_output, reread));
+  EXPECT_EQ(reread.getAllParameterNames(), param_inf.getAllParameterNames());
+}
+
+TEST(YamlIOTest, ParallelReadMatchesSequentialRead)
+{
+  std::string input = "# configuration\ntop_level: 1\n\"quoted key\": 2\nanchored: &value 3\n";
+  for (int i = 0; i < 3000; i++)
+  {
+    if (i % 1000 == 999)
+      input += "---\n";
+    // later documents override the parameters of earlier ones
+    int namespace_index = i % 1000 == 0 ? 5 : i;
+    // aliases referring to other chunks are resolved by parsing the whole input
+    if (i == 500)
+      input += "alias: *value\n";
+    input += "namespace_" + std::to_string(namespace_index) + ":\n  sub:\n    value: " + std::to_string(i) + "\n    vector: [1, " + std::to_string(i) +
+             "]\n    string: \"key: value\"\n  text: |\n    first line\n    second: line\n";
+  }
+  // documents with content behind the start marker are not split
+  input += "--- {inline: 1}\n...\n---\nlast: true\n";
+
+  ParameterInterface sequential;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(input, sequential, 1));
+  ParameterInterface parallel;
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(input, parallel, 4));
+  EXPECT_EQ(parallel.getAllParameterNames(), sequential.getAllParameterNames());
+  EXPECT_EQ(parallel.getFingerprint(), sequential.getFingerprint());
+  EXPECT_EQ(parallel.getParam<int>("namespace_5/sub/value"), 2000);
+  EXPECT_TRUE(parallel.getParam<bool>("last"));
+  EXPECT_EQ(parallel.getParam<int>("alias"), 3);
+
+  // the parameters of each chunk are merged at once
+  ParameterInterface chunked;
+  size_t notification_count = 0;
+  chunked.subscribe("", [&notification_count](const std::vector<std::string>&) { notification_count++; });
+  std::string input_without_alias = input;
+  input_without_alias.erase(input_without_alias.find("alias: *value\n"), 14);
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(input_without_alias, chunked, 4));
+  EXPECT_EQ(chunked.getParam<bool>("last"), true);
+  EXPECT_GT(notification_count, 1) << "The input was not split into chunks";
+  EXPECT_LT(notification_count, 100);
+
+  // the chunks do not allocate from the memory resource of the interface, which does not need to be thread safe
+  auto memory_resource = std::make_shared<SingleThreadMemoryResource>();
+  ParameterInterface single_thread_resource(std::make_shared<StringPool>(), memory_resource);
+  ASSERT_TRUE(YamlIOHandler::readAndAddParametersFromString(input_without_alias, single_thread_resource, 4));
+  EXPECT_EQ(single_thread_resource.getFingerprint(), chunked.getFingerprint());
+  EXPECT_FALSE(memory_resource->used_by_other_thread) << "The memory resource of the interface was used by the parsing threads";
+
+  // errors are reported like by the sequential parser
+  ParameterInterface sequential_invalid;
+  ParameterInterface parallel_invalid;
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString(input_without_alias + "broken: [1, 2\n", sequential_invalid, 1));
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString(input_without_alias + "broken: [1, 2\n", parallel_invalid, 4));
+  EXPECT_EQ(parallel_invalid.getAllParameterNames(), sequential_invalid.getAllParameterNames());
+  ParameterInterface unsupported;
+  EXPECT_FALSE(YamlIOHandler::readAndAddParametersFromString("first: 1\n" + input_without_alias + "nested: [[1]]\n", unsupported, 4));
+  EXPECT_TRUE(unsupported.hasParam("first")) << "Parameters before an unsupported value are added like by the sequential parser";
+}
+
 }  // namespace test
 }  // namespace paraminf